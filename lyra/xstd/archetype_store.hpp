@@ -0,0 +1,212 @@
+#pragma once
+#include <functional>
+#include <string_view>
+#include <tuple>
+#include <vector>
+//
+#include <lyra/xstd/soa_vector.hpp>
+#include <lyra/xstd/type_list.hpp>
+
+namespace lyra::xstd {
+
+// Component sets are canonicalized by sorting and removing duplicates.
+// For a total order on types, their names are compared.
+// The name of a type is part of the signature of a function template
+// that has been instantiated for it.
+//
+namespace detail {
+template <typename type>
+consteval auto type_signature() -> std::string_view {
+#if defined(_MSC_VER) && !defined(__clang__)
+  return __FUNCSIG__;
+#else
+  return __PRETTY_FUNCTION__;
+#endif
+}
+//
+constexpr auto signature_less = []<typename x, typename y> {
+  return type_signature<x>() < type_signature<y>();
+};
+}  // namespace detail
+
+/// Returns the canonical form of a set of components given
+/// by a 'type_list' instance.
+/// All permutations of the same types lead to the same result.
+///
+consteval auto canonical_components(instance::type_list auto list) {
+  return unique(sort(list, detail::signature_less));
+}
+
+/// An entity is a handle to a single row
+/// inside one of the tables of an 'archetype_store'.
+///
+struct entity {
+  uint32 index;
+
+  friend constexpr bool operator==(entity, entity) = default;
+};
+
+// Every archetype is stored inside its own table.
+// The first column of a table contains the entities of its rows.
+// All further columns contain the components in canonical order.
+//
+namespace detail {
+template <typename... components>
+auto archetype_table(type_list<components...>)
+    -> soa_vector<type_list<entity, components...>>;
+//
+template <instance::type_list... keys>
+auto archetype_tables(type_list<keys...>)
+    -> std::tuple<decltype(archetype_table(keys{}))...>;
+}  // namespace detail
+
+/// The template 'archetype_store' is a storage for entities
+/// whose components are grouped by their archetypes.
+/// The archetypes are given as 'type_list' instances of components.
+/// Every archetype is canonicalized.
+/// So, permutations of the same components lead to the same table.
+/// Components are stored in contiguous columns and
+/// queries only iterate over tables that contain all queried components.
+///
+template <instance::type_list list>
+class archetype_store;
+
+template <instance::type_list... archetypes>
+class archetype_store<type_list<archetypes...>> {
+ public:
+  /// The canonicalized archetypes that are stored as tables.
+  ///
+  using keys = decltype(unique(
+      type_list<decltype(canonical_components(archetypes{}))...>{}));
+
+  static constexpr size_t archetype_count = xstd::size(keys{});
+
+  /// Returns the index of the table that stores the given components.
+  ///
+  template <instance::type_list components>
+  static constexpr size_t archetype_index =
+      index_of<decltype(canonical_components(components{}))>(keys{});
+
+  /// Returns the total number of entities.
+  ///
+  auto size() const noexcept { return locations.size() - free_ids.size(); }
+
+  /// Returns the number of entities that consist of the given components.
+  ///
+  template <instance::type_list components>
+    requires(archetype_index<components> < archetype_count)
+  auto size() const noexcept {
+    return std::get<archetype_index<components>>(tables).size();
+  }
+
+  /// Create an entity from the given components.
+  /// The set of components has to be one of the stored archetypes.
+  ///
+  template <typename... components>
+    requires(archetype_index<type_list<std::remove_cvref_t<components>...>> <
+             archetype_count) &&
+            (xstd::size(canonical_components(
+                 type_list<std::remove_cvref_t<components>...>{})) ==
+             sizeof...(components))
+  auto create(components&&... values) -> entity {
+    using list = type_list<std::remove_cvref_t<components>...>;
+    constexpr auto a = archetype_index<list>;
+    auto& table = std::get<a>(tables);
+    const auto result = acquire();
+    auto arguments = std::forward_as_tuple(std::forward<components>(values)...);
+    try {
+      [&]<typename... fields>(type_list<fields...>) {
+        table.push_back(
+            result,
+            std::get<index_of<fields>(list{})>(std::move(arguments))...);
+      }(decltype(element<a>(keys{})){});
+    } catch (...) {
+      free_ids.push_back(result.index);
+      throw;
+    }
+    locations[result.index] = {uint32(a), uint32(table.size() - 1)};
+    return result;
+  }
+
+  /// Destroy the given entity together with all its components.
+  /// The last row of its table is moved into the free row.
+  ///
+  void destroy(entity e) {
+    const auto [a, row] = locations[e.index];
+    visit(keys{}, a, [&]<typename key> {
+      auto& table = std::get<index_of<key>(keys{})>(tables);
+      const auto last = table.size() - 1;
+      if (row != last) {
+        [&]<size_t... k>(std::index_sequence<k...>) {
+          ((table.template column<k>()[row] =
+                std::move(table.template column<k>()[last])),
+           ...);
+        }(std::make_index_sequence<1 + xstd::size(key{})>{});
+        locations[table.template column<0>()[row].index].row = row;
+      }
+      table.pop_back();
+    });
+    free_ids.push_back(e.index);
+  }
+
+  /// Access a component of the given entity.
+  /// If the entity does not own such a component, 'nullptr' is returned.
+  ///
+  template <typename component>
+  auto get(entity e) noexcept -> component* {
+    const auto [a, row] = locations[e.index];
+    return visit(keys{}, a, [&]<typename key>() -> component* {
+      if constexpr (contains<component>(key{}))
+        return &std::get<index_of<key>(keys{})>(tables)
+                    .template column<component>()[row];
+      else
+        return nullptr;
+    });
+  }
+
+  /// Call the given function object for all entities
+  /// that own all of the given components.
+  /// The components are given as arguments in the order of the query.
+  /// Tables that do not match are ruled out at compile time.
+  /// So, there are no checks for single entities.
+  ///
+  template <typename... components>
+  void for_each(auto&& f) {
+    constexpr auto matches = filter(keys{}, []<typename key> {
+      return (contains<components>(key{}) && ...);
+    });
+    [&]<typename... ks>(type_list<ks...>) {
+      (scan<components...>(std::get<index_of<ks>(keys{})>(tables), f), ...);
+    }(matches);
+  }
+
+ private:
+  struct location {
+    uint32 archetype;
+    uint32 row;
+  };
+
+  template <typename... components>
+  static void scan(auto& table, auto& f) {
+    const auto n = table.size();
+    [&](auto... columns) {
+      for (size_t i = 0; i < n; ++i) std::invoke(f, columns[i]...);
+    }(table.template column<components>()...);
+  }
+
+  auto acquire() -> entity {
+    if (free_ids.empty()) {
+      locations.push_back({});
+      return {uint32(locations.size() - 1)};
+    }
+    const auto result = free_ids.back();
+    free_ids.pop_back();
+    return {result};
+  }
+
+  decltype(detail::archetype_tables(keys{})) tables{};
+  std::vector<location> locations{};
+  std::vector<uint32> free_ids{};
+};
+
+}  // namespace lyra::xstd
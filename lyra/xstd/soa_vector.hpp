@@ -0,0 +1,281 @@
+#pragma once
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <span>
+#include <tuple>
+//
+#include <lyra/xstd/type_list.hpp>
+
+namespace lyra::xstd {
+
+/// The template 'soa_vector' is a growable container
+/// that stores its elements as a structure of arrays.
+/// The fields of every element are given by a 'type_list' instance.
+/// Each field is stored in its own contiguous column.
+/// All columns share the same capacity and live inside a single allocation.
+/// The beginning of every column is aligned for SIMD instructions.
+///
+template <instance::type_list list>
+class soa_vector;
+
+template <typename... types>
+class soa_vector<type_list<types...>> {
+  // Reallocation moves the columns one after another.
+  // To not end up with partially moved elements, moves must not throw.
+  static_assert((std::is_nothrow_move_constructible_v<types> && ...));
+  static_assert((std::is_nothrow_destructible_v<types> && ...));
+
+ public:
+  using fields = type_list<types...>;
+  using size_type = size_t;
+
+  template <size_t index>
+  using field = decltype(element<index>(fields{}));
+
+  static constexpr size_t field_count = sizeof...(types);
+
+  /// Every column is at least aligned to the size of a cache line.
+  /// This allows for aligned vector loads of all supported widths.
+  ///
+  static constexpr size_t alignment =
+      std::max({size_t{64}, alignof(types)...});
+
+  /// A proxy that references the fields of a single element.
+  /// It is returned by 'operator[]' for convenience.
+  /// Inside hot loops, the columns should be accessed directly instead.
+  ///
+  template <bool constant>
+  class row_reference {
+   public:
+    using container =
+        std::conditional_t<constant, const soa_vector, soa_vector>;
+
+    row_reference(container& c, size_type i) noexcept : self{&c}, index{i} {}
+
+    /// Access the field of the referenced element by its index.
+    ///
+    template <size_t k>
+    decltype(auto) get() const noexcept {
+      return self->template data<k>()[index];
+    }
+
+    /// Copy all referenced fields into a tuple.
+    ///
+    auto value() const {
+      return [&]<size_t... k>(std::index_sequence<k...>) {
+        return std::tuple<types...>{get<k>()...};
+      }(std::index_sequence_for<types...>{});
+    }
+
+   private:
+    container* self;
+    size_type index;
+  };
+  using reference = row_reference<false>;
+  using const_reference = row_reference<true>;
+
+  soa_vector() noexcept = default;
+
+  explicit soa_vector(size_type n) { resize(n); }
+
+  soa_vector(const soa_vector& x) {
+    reserve(x.size());
+    construct_columns(0, x.size(), [&]<size_t k> {
+      std::uninitialized_copy_n(x.template data<k>(), x.size(), data<k>());
+    });
+    count = x.size();
+  }
+
+  soa_vector& operator=(const soa_vector& x) {
+    soa_vector copy{x};
+    swap(copy);
+    return *this;
+  }
+
+  soa_vector(soa_vector&& x) noexcept { swap(x); }
+
+  soa_vector& operator=(soa_vector&& x) noexcept {
+    soa_vector tmp{std::move(x)};
+    swap(tmp);
+    return *this;
+  }
+
+  ~soa_vector() noexcept {
+    clear();
+    deallocate(memory);
+  }
+
+  void swap(soa_vector& x) noexcept {
+    std::swap(memory, x.memory);
+    std::swap(count, x.count);
+    std::swap(slots, x.slots);
+  }
+
+  auto size() const noexcept { return count; }
+  auto capacity() const noexcept { return slots; }
+  bool empty() const noexcept { return count == 0; }
+
+  /// Returns a pointer to the beginning of a column
+  /// that is aligned by the value of 'alignment'.
+  ///
+  template <size_t index>
+  auto data() noexcept {
+    return std::assume_aligned<alignment>(
+        reinterpret_cast<field<index>*>(memory + offsets(slots)[index]));
+  }
+  //
+  template <size_t index>
+  auto data() const noexcept {
+    return std::assume_aligned<alignment>(
+        reinterpret_cast<const field<index>*>(memory +
+                                              offsets(slots)[index]));
+  }
+
+  /// Access the contiguous column of a field by its index.
+  ///
+  template <size_t index>
+  auto column() noexcept {
+    return std::span<field<index>>{data<index>(), count};
+  }
+  //
+  template <size_t index>
+  auto column() const noexcept {
+    return std::span<const field<index>>{data<index>(), count};
+  }
+
+  /// Access the contiguous column of a field by its type.
+  /// This is only possible if the type is unique inside the fields.
+  ///
+  template <typename type>
+  auto column() noexcept
+    requires((size_t{meta::equal<type, types>} + ...) == 1)
+  {
+    return column<index_of<type>(fields{})>();
+  }
+  //
+  template <typename type>
+  auto column() const noexcept
+    requires((size_t{meta::equal<type, types>} + ...) == 1)
+  {
+    return column<index_of<type>(fields{})>();
+  }
+
+  auto operator[](size_type i) noexcept {
+    assert(i < count);
+    return reference{*this, i};
+  }
+  //
+  auto operator[](size_type i) const noexcept {
+    assert(i < count);
+    return const_reference{*this, i};
+  }
+
+  void reserve(size_type n) {
+    if (n <= slots) return;
+    const auto new_memory = allocate(n);
+    const auto new_offsets = offsets(n);
+    for_each_column([&]<size_t k> {
+      const auto first = data<k>();
+      std::uninitialized_move_n(
+          first, count,
+          reinterpret_cast<field<k>*>(new_memory + new_offsets[k]));
+      std::destroy_n(first, count);
+    });
+    deallocate(memory);
+    memory = new_memory;
+    slots = n;
+  }
+
+  void resize(size_type n) {
+    if (n <= count) {
+      for_each_column(
+          [&]<size_t k> { std::destroy(data<k>() + n, data<k>() + count); });
+      count = n;
+      return;
+    }
+    reserve(n);
+    construct_columns(count, n, [&]<size_t k> {
+      std::uninitialized_value_construct(data<k>() + count, data<k>() + n);
+    });
+    count = n;
+  }
+
+  void clear() noexcept { resize(0); }
+
+  /// Append an element given by the values of all its fields.
+  ///
+  template <typename... args>
+  void push_back(args&&... values)
+    requires(sizeof...(args) == field_count) &&
+            (std::constructible_from<types, args&&> && ...)
+  {
+    if (count == slots) reserve(std::max(size_type{8}, 2 * slots));
+    auto arguments = std::forward_as_tuple(std::forward<args>(values)...);
+    construct_columns(count, count + 1, [&]<size_t k> {
+      std::construct_at(data<k>() + count, std::get<k>(std::move(arguments)));
+    });
+    ++count;
+  }
+
+  void pop_back() noexcept {
+    assert(!empty());
+    resize(count - 1);
+  }
+
+ private:
+  static constexpr auto round_up(size_t bytes) noexcept {
+    return (bytes + alignment - 1) / alignment * alignment;
+  }
+
+  // Computes the byte offsets of all columns for a given capacity.
+  // The last entry is the size of the whole allocation.
+  //
+  static constexpr auto offsets(size_type n) noexcept {
+    constexpr std::array<size_t, field_count> sizes{sizeof(types)...};
+    std::array<size_t, field_count + 1> result{};
+    for (size_t i = 0; i < field_count; ++i)
+      result[i + 1] = result[i] + round_up(n * sizes[i]);
+    return result;
+  }
+
+  static auto allocate(size_type n) {
+    return static_cast<std::byte*>(::operator new(
+        offsets(n)[field_count], std::align_val_t{alignment}));
+  }
+
+  static void deallocate(std::byte* ptr) noexcept {
+    if (ptr) ::operator delete(ptr, std::align_val_t{alignment});
+  }
+
+  void for_each_column(auto&& f) {
+    [&]<size_t... k>(std::index_sequence<k...>) {
+      (f.template operator()<k>(), ...);
+    }(std::index_sequence_for<types...>{});
+  }
+
+  // Constructs the elements inside '[first, last)' column by column.
+  // If the construction throws for one column,
+  // the elements of all previously constructed columns are destroyed.
+  //
+  void construct_columns(size_type first, size_type last, auto&& f) {
+    size_t constructed = 0;
+    try {
+      for_each_column([&]<size_t k> {
+        f.template operator()<k>();
+        ++constructed;
+      });
+    } catch (...) {
+      for_each_column([&]<size_t k> {
+        if (k < constructed) std::destroy(data<k>() + first, data<k>() + last);
+      });
+      throw;
+    }
+  }
+
+  std::byte* memory = nullptr;
+  size_type count = 0;
+  size_type slots = 0;
+};
+
+}  // namespace lyra::xstd
@@ -0,0 +1,131 @@
+#pragma once
+#include <tuple>
+//
+#include <lyra/xstd/type_list.hpp>
+
+namespace lyra::xstd {
+
+// Every element of a tuple is stored inside its own leaf.
+// The leaf is identified by the logical index of the element.
+// So, even equal types lead to unique base classes and
+// accessing an element is a single derived-to-base conversion.
+//
+namespace detail {
+template <size_t index, typename type>
+struct tuple_leaf {
+  [[no_unique_address]] type value;
+
+  friend constexpr bool operator==(const tuple_leaf&,
+                                   const tuple_leaf&) = default;
+};
+
+// The storage inherits from all leaves in their physical order.
+// All leaves are direct bases.
+// So, no recursive nesting is needed.
+//
+template <instance::type_list leaves>
+struct tuple_storage;
+template <size_t... indices, typename... types>
+struct tuple_storage<type_list<tuple_leaf<indices, types>...>>
+    : tuple_leaf<indices, types>... {
+  constexpr tuple_storage() = default;
+
+  // The arguments are given in logical order.
+  // Every leaf picks its argument by its logical index.
+  //
+  constexpr tuple_storage(std::in_place_t, auto&& arguments)
+      : tuple_leaf<indices, types>(
+            std::get<indices>(std::move(arguments)))... {}
+
+  friend constexpr bool operator==(const tuple_storage&,
+                                   const tuple_storage&) = default;
+};
+
+// Laying out the leaves by decreasing alignment leaves no padding
+// between them because every size is a multiple of its alignment.
+// A stable sort keeps the logical order for equal alignments.
+//
+template <typename... types>
+consteval auto tuple_layout() {
+  return []<size_t... indices>(std::index_sequence<indices...>) {
+    return stable_sort(type_list<tuple_leaf<indices, types>...>{},
+                       []<typename x, typename y> {
+                         return alignof(x) > alignof(y);
+                       });
+  }(std::index_sequence_for<types...>{});
+}
+}  // namespace detail
+
+/// The template 'tuple' is a heterogeneous product type
+/// whose element types are given by a 'type_list' instance.
+/// In contrast to 'std::tuple', the physical order of its elements
+/// is computed at compile time to minimize the padding.
+/// The logical order of the element types is kept for all accessors.
+///
+template <instance::type_list list>
+class tuple;
+
+template <typename... types>
+class tuple<type_list<types...>>
+    : public detail::tuple_storage<
+          decltype(detail::tuple_layout<types...>())> {
+  using base =
+      detail::tuple_storage<decltype(detail::tuple_layout<types...>())>;
+
+ public:
+  using fields = type_list<types...>;
+
+  constexpr tuple() = default;
+
+  template <typename... args>
+    requires(sizeof...(args) == sizeof...(types)) &&
+            (sizeof...(args) > 0) &&
+            (std::constructible_from<types, args&&> && ...)
+  constexpr explicit(!(std::convertible_to<args&&, types> && ...))
+      tuple(args&&... values)
+      : base{std::in_place,
+             std::forward_as_tuple(std::forward<args>(values)...)} {}
+
+  friend constexpr bool operator==(const tuple&, const tuple&) = default;
+};
+
+/// Deduce the element types from the given values.
+///
+template <typename... types>
+tuple(types...) -> tuple<type_list<types...>>;
+
+/// Access an element of a 'tuple' instance by its logical index.
+///
+template <size_t index, typename... types>
+constexpr auto get(tuple<type_list<types...>>& t) noexcept -> auto& {
+  using type = decltype(element<index>(type_list<types...>{}));
+  return static_cast<detail::tuple_leaf<index, type>&>(t).value;
+}
+//
+template <size_t index, typename... types>
+constexpr auto get(const tuple<type_list<types...>>& t) noexcept
+    -> const auto& {
+  using type = decltype(element<index>(type_list<types...>{}));
+  return static_cast<const detail::tuple_leaf<index, type>&>(t).value;
+}
+//
+template <size_t index, typename... types>
+constexpr auto get(tuple<type_list<types...>>&& t) noexcept -> auto&& {
+  using type = decltype(element<index>(type_list<types...>{}));
+  return std::move(static_cast<detail::tuple_leaf<index, type>&>(t).value);
+}
+
+}  // namespace lyra::xstd
+
+// Allow for structured bindings.
+//
+template <typename... types>
+struct std::tuple_size<lyra::xstd::tuple<lyra::xstd::type_list<types...>>>
+    : std::integral_constant<size_t, sizeof...(types)> {};
+//
+template <size_t index, typename... types>
+struct std::tuple_element<index,
+                          lyra::xstd::tuple<lyra::xstd::type_list<types...>>> {
+  using type = decltype(lyra::xstd::element<index>(
+      lyra::xstd::type_list<types...>{}));
+};
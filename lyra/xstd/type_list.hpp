@@ -1,4 +1,6 @@
 #pragma once
+#include <array>
+//
 #include <lyra/xstd/utility.hpp>
 
 namespace lyra::xstd {
@@ -118,19 +120,46 @@ consteval auto contains(instance::type_list auto list, type_list<type>) {
 /// Accessors
 ///
 
-/// Access a specific type of a 'type_list' instance by its index.
-///
-template <size_t index>
-auto element(type_list<>) = delete;
+// Indexed access into a parameter pack should not peel off
+// one type after another by recursion.
+// Otherwise, every access would need O(index) instantiations
+// and the list size would be limited by the template depth.
+// Instead, we use pack indexing or the respective compiler builtin.
+// If none is available, the index is resolved by overload resolution
+// over a flat base class set with its respective indices.
 //
-template <size_t index, typename type, typename... types>
-auto element(type_list<type, types...> list)
-    -> decltype(element<index - 1>(type_list<types...>{}))
-  requires((0 < index) && (index < size(list)));
+namespace detail {
+#if defined(__cpp_pack_indexing)
+template <size_t index, typename... types>
+using type_pack_element = types...[index];
+#elif LYRA_XSTD_HAS_BUILTIN(__type_pack_element)
+template <size_t index, typename... types>
+using type_pack_element = __type_pack_element<index, types...>;
+#else
+template <size_t index, typename type>
+struct indexed_type {};
 //
-template <size_t index, typename type, typename... types>
-auto element(type_list<type, types...>) -> type
-  requires(index == 0);
+template <typename indices, typename... types>
+struct indexed_types;
+template <size_t... indices, typename... types>
+struct indexed_types<std::index_sequence<indices...>, types...>
+    : indexed_type<indices, types>... {};
+//
+template <size_t index, typename type>
+auto select(indexed_type<index, type>) -> std::type_identity<type>;
+//
+template <size_t index, typename... types>
+using type_pack_element = typename decltype(detail::select<index>(
+    indexed_types<std::index_sequence_for<types...>, types...>{}))::type;
+#endif
+}  // namespace detail
+
+/// Access a specific type of a 'type_list' instance by its index.
+///
+template <size_t index, typename... types>
+auto element(type_list<types...>)
+    -> detail::type_pack_element<index, types...>
+  requires(index < sizeof...(types));
 
 /// Access a specific type of a 'type_list' instance by its index.
 /// The result type is wrapped by the 'type_list' template
@@ -180,6 +209,80 @@ consteval auto operator!(instance::type_list auto list) {
   return back_slice(list);
 }
 
+///
+/// Searching
+///
+
+// Searching evaluates the predicate exactly once for every type.
+// The resulting 'constexpr' mask is then processed
+// by ordinary 'constexpr' code instead of recursive instantiations.
+//
+namespace detail {
+template <auto values>
+consteval auto sum() {
+  size_t result = 0;
+  for (auto x : values) result += x;
+  return result;
+}
+//
+template <auto mask>
+consteval auto mask_indices() {
+  std::array<size_t, sum<mask>()> result{};
+  for (size_t i = 0, j = 0; i < mask.size(); ++i)
+    if (mask[i]) result[j++] = i;
+  return result;
+}
+//
+template <auto mask>
+consteval auto first_index() {
+  size_t i = 0;
+  while ((i < mask.size()) && !mask[i]) ++i;
+  return i;
+}
+}  // namespace detail
+
+/// Returns the index of the first type inside a 'type_list' instance
+/// for which the given predicate returns 'true'.
+/// If there is no such type, the size of the list is returned.
+///
+template <typename... types>
+consteval auto find_if(type_list<types...>, auto f) -> size_t {
+  constexpr std::array<bool, sizeof...(types)> mask{
+      bool(f.template operator()<types>())...};
+  return detail::first_index<mask>();
+}
+
+/// Returns the index of the first occurrence of a given type
+/// inside a 'type_list' instance.
+/// If the type is not contained, the size of the list is returned.
+///
+template <typename type, typename... types>
+consteval auto index_of(type_list<types...>) -> size_t {
+  constexpr std::array<bool, sizeof...(types)> mask{
+      meta::equal<type, types>...};
+  return detail::first_index<mask>();
+}
+
+/// Returns the number of types inside a 'type_list' instance
+/// for which the given predicate returns 'true'.
+///
+template <typename... types>
+consteval auto count_if(type_list<types...>, auto f) -> size_t {
+  return (size_t{bool(f.template operator()<types>())} + ... + 0);
+}
+
+/// Returns the indices of all types inside a 'type_list' instance
+/// for which the given predicate returns 'true' in increasing order.
+/// The result is given as 'std::array' to be usable for
+/// the construction of lookup tables at compile time.
+///
+template <typename... types>
+consteval auto indices_if(type_list<types...>, auto f) {
+  constexpr std::array<bool, sizeof...(types)> mask{
+      bool(f.template operator()<types>())...};
+  return detail::mask_indices<mask>();
+}
+
 ///
 /// Modifiers
 ///
@@ -200,12 +303,63 @@ consteval auto push_back(type_list<types...>) {
   return type_list<types..., type>{};
 }
 
+// Concatenating many 'type_list' instances pairwise would create
+// an intermediate list for every step.
+// Instead, every type of the result is identified by the index of its list
+// and its index inside that list.
+// Both are computed at compile time such that the result
+// can be built by a single pack expansion.
+//
+namespace detail {
+template <size_t index, typename list>
+struct list_element;
+template <size_t index, typename... types>
+struct list_element<index, type_list<types...>> {
+  using type = type_pack_element<index, types...>;
+};
+
+template <auto outer, auto inner, typename... lists>
+consteval auto gather_nested(lists...) {
+  return []<size_t... k>(std::index_sequence<k...>) {
+    return type_list<typename list_element<
+        inner[k], type_pack_element<outer[k], lists...>>::type...>{};
+  }(std::make_index_sequence<outer.size()>{});
+}
+
+template <auto sizes>
+consteval auto outer_indices() {
+  std::array<size_t, sum<sizes>()> result{};
+  for (size_t i = 0, k = 0; i < sizes.size(); ++i)
+    for (size_t j = 0; j < sizes[i]; ++j, ++k) result[k] = i;
+  return result;
+}
+//
+template <auto sizes>
+consteval auto inner_indices() {
+  std::array<size_t, sum<sizes>()> result{};
+  for (size_t i = 0, k = 0; i < sizes.size(); ++i)
+    for (size_t j = 0; j < sizes[i]; ++j, ++k) result[k] = j;
+  return result;
+}
+}  // namespace detail
+
 /// Concatenate two given 'type_list' instances.
 ///
 template <typename... x, typename... y>
 consteval auto concat(type_list<x...>, type_list<y...>) {
   return type_list<x..., y...>{};
 }
+
+/// Concatenate an arbitrary amount of 'type_list' instances.
+/// The result is built by a single pack expansion
+/// and does not create intermediate lists.
+///
+template <instance::type_list... lists>
+consteval auto concat(lists...) {
+  constexpr std::array<size_t, sizeof...(lists)> sizes{size(lists{})...};
+  return detail::gather_nested<detail::outer_indices<sizes>(),
+                               detail::inner_indices<sizes>()>(lists{}...);
+}
 //
 consteval auto operator+(instance::type_list auto x,
                          instance::type_list auto y) {
@@ -225,18 +379,40 @@ consteval auto operator--(instance::type_list auto list) {
   return pop_front(list);
 }
 
+// Removing types from the back or taking a subrange should not
+// remove one type after another by recursion.
+// Instead, the types inside the window are accessed by their index
+// in a single pack expansion over an index sequence.
+// This needs a linear number of instantiations and constant depth.
+//
+namespace detail {
+template <size_t first, size_t last, typename... types>
+consteval auto subrange(type_list<types...>)
+  requires((first <= last) && (last <= sizeof...(types)))
+{
+  return []<size_t... indices>(std::index_sequence<indices...>) {
+    return type_list<type_pack_element<first + indices, types...>...>{};
+  }(std::make_index_sequence<last - first>{});
+}
+
+// More general modifications are described by an array of source indices
+// that has been computed at compile time by ordinary 'constexpr' code.
+// The result is then gathered in a single pack expansion as well.
+//
+template <auto indices, typename... types>
+consteval auto gather(type_list<types...>) {
+  return []<size_t... k>(std::index_sequence<k...>) {
+    return type_list<type_pack_element<indices[k], types...>...>{};
+  }(std::make_index_sequence<indices.size()>{});
+}
+}  // namespace detail
+
 /// Remove the last element of a 'type_list' instance.
 ///
 consteval auto pop_back(type_list<>) = delete;
 //
-template <typename type>
-consteval auto pop_back(type_list<type>) {
-  return type_list<>{};
-}
-//
 consteval auto pop_back(instance::type_list auto list) {
-  // return push_front<decltype(front(list))>(pop_back(pop_front(list)));
-  return *list + pop_back(--list);
+  return detail::subrange<0, size(list) - 1>(list);
 }
 //
 consteval auto operator--(instance::type_list auto list, int) {
@@ -244,110 +420,107 @@ consteval auto operator--(instance::type_list auto list, int) {
 }
 
 /// Reverse the order of types inside a 'type_list' instance.
+/// The result is built by a single pack expansion
+/// over the reversed index sequence of the given types.
 ///
-consteval auto reverse(type_list<> list) {
-  return list;
-}
-//
-consteval auto reverse(instance::type_list auto list) {
-  // return push_back<decltype(front(list))>(reverse(pop_front(list)));
-  return reverse(--list) + *list;
+template <typename... types>
+consteval auto reverse(type_list<types...>) {
+  constexpr auto n = sizeof...(types);
+  return []<size_t... indices>(std::index_sequence<indices...>) {
+    return type_list<detail::type_pack_element<n - 1 - indices, types...>...>{};
+  }(std::make_index_sequence<n>{});
 }
 //
 consteval auto operator~(instance::type_list auto list) {
   return reverse(list);
 }
 
-/// Insert a type at a given index into a 'type_list' instance;
+/// Insert a type at a given index into a 'type_list' instance.
 ///
-template <size_t index, typename type>
-consteval auto insert(instance::type_list auto list)
+template <size_t index, typename type, typename... types>
+consteval auto insert(type_list<types...> list)
   requires(index <= size(list))
 {
-  if constexpr (index == 0)
-    return push_front<type>(list);
-  else
-    // return push_front<decltype(front(list))>(
-    //     insert<index - 1, type>(pop_front(list)));
-    return *list + insert<index - 1, type>(--list);
+  // The inserted type is appended to the source types.
+  constexpr auto n = sizeof...(types);
+  return []<size_t... k>(std::index_sequence<k...>) {
+    return type_list<detail::type_pack_element<
+        (k < index) ? k : ((k == index) ? n : k - 1), types..., type>...>{};
+  }(std::make_index_sequence<n + 1>{});
 }
 
 /// Insert a type into a 'type_list' instance by using predicate.
+/// The type is inserted in front of the first type
+/// that is not less than the given type.
 ///
 template <typename type>
-consteval auto insert(type_list<>, auto less) {
-  return type_list<type>{};
-}
-//
-template <typename type>
 consteval auto insert(instance::type_list auto list, auto less) {
-  if constexpr (less.template operator()<type, decltype(front(list))>())
-    return push_front<type>(list);
-  else
-    // return push_front<decltype(front(list))>(
-    //     insert<type>(pop_front(list), less));
-    return *list + insert<type>(--list, less);
+  constexpr auto index = find_if(list, [less]<typename x> {
+    return less.template operator()<type, x>();
+  });
+  return insert<index, type>(list);
 }
 
 /// Remove a type at a given index from a 'type_list' instance.
 ///
-template <size_t index>
-consteval auto remove(instance::type_list auto list)
+template <size_t index, typename... types>
+consteval auto remove(type_list<types...> list)
   requires(index < size(list))
 {
-  if constexpr (index == 0)
-    // return pop_front(list);
-    return --list;
-  else
-    // return push_front<decltype(front(list))>(
-    //     remove<index - 1>(pop_front(list)));
-    return *list + remove<index - 1>(--list);
+  return []<size_t... k>(std::index_sequence<k...>) {
+    return type_list<
+        detail::type_pack_element<(k < index) ? k : k + 1, types...>...>{};
+  }(std::make_index_sequence<sizeof...(types) - 1>{});
+}
+
+/// Keep all types of a 'type_list' instance
+/// for which the given predicate returns 'true'.
+/// The predicate is evaluated once for every type
+/// and the result is built by a single pack expansion.
+///
+consteval auto filter(instance::type_list auto list, auto f) {
+  constexpr auto indices = indices_if(list, f);
+  return detail::gather<indices>(list);
 }
 
 /// Remove all types from a 'type_list' instance
 /// for which the given predicate returns 'true'.
 ///
-consteval auto remove(type_list<> list, auto f) {
-  return list;
+template <typename... types>
+consteval auto remove(type_list<types...> list, auto f) {
+  constexpr std::array<bool, sizeof...(types)> mask{
+      !f.template operator()<types>()...};
+  return detail::gather<detail::mask_indices<mask>()>(list);
 }
-//
-consteval auto remove(instance::type_list auto list, auto f) {
-  if constexpr (f.template operator()<decltype(front(list))>())
-    // return remove(pop_front(list), f);
-    return remove(--list, f);
-  else
-    // return push_front<decltype(front(list))>(remove(pop_front(list), f));
-    return *list + remove(--list, f);
+
+/// Remove all duplicates from a 'type_list' instance.
+/// Only the first occurrence of every type is kept.
+///
+template <typename... types>
+consteval auto unique(type_list<types...> list) {
+  constexpr auto mask = []<size_t... indices>(std::index_sequence<indices...>) {
+    return std::array<bool, sizeof...(types)>{
+        (index_of<types>(type_list<types...>{}) == indices)...};
+  }(std::index_sequence_for<types...>{});
+  return detail::gather<detail::mask_indices<mask>()>(list);
 }
 
 /// Remove a given amount of types from the front of a 'type_list' instance.
 ///
-template <size_t n>
-  requires(n == 0)
-consteval auto trim_front(instance::type_list auto list) {
-  return list;
-}
-//
 template <size_t n>
 consteval auto trim_front(instance::type_list auto list)
-  requires((0 < n) && (n <= size(list)))
+  requires(n <= size(list))
 {
-  return trim_front<n - 1>(pop_front(list));
+  return detail::subrange<n, size(list)>(list);
 }
 
 /// Remove a given amount of types from the back of a 'type_list' instance.
 ///
-template <size_t n>
-  requires(n == 0)
-consteval auto trim_back(instance::type_list auto list) {
-  return list;
-}
-//
 template <size_t n>
 consteval auto trim_back(instance::type_list auto list)
-  requires((0 < n) && (n <= size(list)))
+  requires(n <= size(list))
 {
-  return trim_back<n - 1>(pop_back(list));
+  return detail::subrange<0, size(list) - n>(list);
 }
 
 /// Get a subrange of types from a 'type_list' instance.
@@ -356,78 +529,261 @@ template <size_t first, size_t last>
 consteval auto range(instance::type_list auto list)
   requires((first <= last) && (last <= size(list)))
 {
-  constexpr auto n = size(list);
-  return trim_front<first>(trim_back<n - last>(list));
+  return detail::subrange<first, last>(list);
 }
 
 /// Swap two types given by their position inside a 'type_list' instance.
+/// Every position is mapped to its source position
+/// such that the result is built by a single pack expansion.
 ///
-template <size_t i, size_t j>
-consteval auto swap(instance::type_list auto list)
-  requires((i == j) && (j < size(list)))
+template <size_t i, size_t j, typename... types>
+consteval auto swap(type_list<types...> list)
+  requires((i < size(list)) && (j < size(list)))
 {
-  return list;
+  return []<size_t... indices>(std::index_sequence<indices...>) {
+    return type_list<detail::type_pack_element<
+        (indices == i) ? j : ((indices == j) ? i : indices), types...>...>{};
+  }(std::index_sequence_for<types...>{});
+}
+
+// Ordering types by recursive merging would create
+// a new 'type_list' instance for every single step.
+// Instead, the predicate is evaluated for all needed pairs of types
+// and stored in a 'constexpr' matrix.
+// The order is then computed by ordinary 'constexpr' code on indices
+// and the result is gathered in a single pack expansion.
+//
+namespace detail {
+template <typename x, typename... types>
+consteval auto comparison_row(auto less) {
+  return std::array<bool, sizeof...(types)>{
+      bool(less.template operator()<x, types>())...};
 }
 //
-template <size_t i, size_t j>
-consteval auto swap(instance::type_list auto list)
-  requires((i < j) && (j < size(list)))
-{
-  constexpr auto n = size(list);
-  return range<0, i>(list) + slice<j>(list) + range<i + 1, j>(list) +
-         slice<i>(list) + range<j + 1, n>(list);
+template <typename... x, typename... y>
+consteval auto comparisons(type_list<x...>, type_list<y...>, auto less) {
+  return std::array<std::array<bool, sizeof...(y)>, sizeof...(x)>{
+      comparison_row<x, y...>(less)...};
 }
+
+// The entry 'take_left[i][j]' decides whether the i-th type of the left
+// list is put in front of the j-th type of the right list.
+// Indices of the right list are offset by the size of the left list.
 //
-template <size_t i, size_t j>
-consteval auto swap(instance::type_list auto list)
-  requires((j < i) && (i < size(list)))
-{
-  return swap<j, i>(list);
+template <size_t m, size_t n>
+consteval auto merge_indices(
+    const std::array<std::array<bool, n>, m>& take_left) {
+  std::array<size_t, m + n> result{};
+  size_t i = 0, j = 0, k = 0;
+  while ((i < m) && (j < n))
+    result[k++] = take_left[i][j] ? i++ : m + j++;
+  while (i < m) result[k++] = i++;
+  while (j < n) result[k++] = m + j++;
+  return result;
+}
+
+// Top-down merge sort on the indices inside '[first, last)'.
+// The split is the same as the one that is used for 'type_list' instances.
+// For a stable sort, the right index is only put in front
+// if it is strictly less than the left index.
+//
+template <size_t n>
+consteval void merge_sort(std::array<size_t, n>& indices,
+                          std::array<size_t, n>& buffer,
+                          size_t first,
+                          size_t last,
+                          const std::array<std::array<bool, n>, n>& less,
+                          bool stable) {
+  if (last - first < 2) return;
+  const auto half = first + (last - first) / 2;
+  merge_sort(indices, buffer, first, half, less, stable);
+  merge_sort(indices, buffer, half, last, less, stable);
+  size_t i = first, j = half, k = first;
+  while ((i < half) && (j < last)) {
+    const auto take_left =
+        stable ? !less[indices[j]][indices[i]] : less[indices[i]][indices[j]];
+    buffer[k++] = take_left ? indices[i++] : indices[j++];
+  }
+  while (i < half) buffer[k++] = indices[i++];
+  while (j < last) buffer[k++] = indices[j++];
+  for (k = first; k < last; ++k) indices[k] = buffer[k];
+}
+//
+template <size_t n>
+consteval auto sort_indices(const std::array<std::array<bool, n>, n>& less,
+                            bool stable) {
+  std::array<size_t, n> result{};
+  std::array<size_t, n> buffer{};
+  for (size_t i = 0; i < n; ++i) result[i] = i;
+  merge_sort(result, buffer, 0, n, less, stable);
+  return result;
 }
+}  // namespace detail
 
 /// Merge two sorted 'type_list' instances by using a 'less' predicate.
+/// A type of the left list is put in front of a type of the right list
+/// if and only if the predicate returns 'true' for them.
 ///
-consteval auto merge(instance::type_list auto left,
-                     instance::type_list auto right,
-                     auto less)
-  requires(empty(left) || empty(right))
-{
-  return left + right;
-}
-//
 consteval auto merge(instance::type_list auto left,
                      instance::type_list auto right,
                      auto less) {
-  if constexpr (less.template  //
-                operator()<decltype(front(left)), decltype(front(right))>())
-    return push_front<decltype(front(left))>(
-        merge(pop_front(left), right, less));
-  else
-    return push_front<decltype(front(right))>(
-        merge(left, pop_front(right), less));
+  constexpr auto indices =
+      detail::merge_indices(detail::comparisons(left, right, less));
+  return detail::gather<indices>(left + right);
 }
 
 /// Sort a 'type_list' instance by using a 'less' predicate.
+/// The algorithm is a merge sort that, for every merge,
+/// puts a type of the left part in front of a type of the right part
+/// if and only if the predicate returns 'true' for them.
 ///
 consteval auto sort(instance::type_list auto list, auto less) {
-  constexpr auto n = size(list);
-  constexpr auto half = n / 2;
-  return merge(sort(range<0, half>(list), less),
-               sort(range<half, n>(list), less), less);
+  constexpr auto indices =
+      detail::sort_indices(detail::comparisons(list, list, less), false);
+  return detail::gather<indices>(list);
 }
-//
-consteval auto sort(instance::type_list auto list, auto less)
-  requires(size(list) < 2)
-{
-  return list;
+
+/// Sort a 'type_list' instance by using a strict 'less' predicate
+/// while preserving the relative order of equivalent types.
+///
+consteval auto stable_sort(instance::type_list auto list, auto less) {
+  constexpr auto indices =
+      detail::sort_indices(detail::comparisons(list, list, less), true);
+  return detail::gather<indices>(list);
 }
 
+/// Concatenate all 'type_list' instances
+/// that are contained inside a given 'type_list' instance.
 ///
+template <instance::type_list... lists>
+consteval auto join(type_list<lists...>) {
+  return concat(lists{}...);
+}
+
+/// Map every type of a 'type_list' instance to a 'type_list' instance
+/// by the given function and concatenate all the results.
+/// So, types can be replaced, removed, or multiplied.
 ///
 template <typename... types>
 consteval auto transform(type_list<types...>, auto f) {
   // f needs to return slices
-  return (f.template operator()<types>() + ...);
+  return concat(f.template operator()<types>()...);
+}
+
+/// Recursively replace all 'type_list' instances
+/// inside a 'type_list' instance by their contained types.
+///
+consteval auto flatten(instance::type_list auto list) {
+  return transform(list, []<typename x> {
+    if constexpr (instance::type_list<x>)
+      return flatten(x{});
+    else
+      return type_list<x>{};
+  });
+}
+
+///
+/// Visitation
+///
+
+// Runtime dispatch into type-specialized code is done by a table
+// of function pointers that is generated at compile time.
+// Every entry calls the given function object for one combination of types.
+// So, a dispatch costs exactly one indirect call and no branches.
+//
+namespace detail {
+template <typename functor, typename result, typename... types>
+constexpr auto visit_entry(functor& f) -> result {
+  return f.template operator()<types...>();
+}
+//
+template <typename functor, typename result, typename list>
+constexpr result (*visit_entry_for)(functor&) = nullptr;
+template <typename functor, typename result, typename... types>
+constexpr result (*visit_entry_for<functor, result, type_list<types...>>)(
+    functor&) = &visit_entry<functor, result, types...>;
+
+template <typename functor, typename result, typename... types>
+inline constexpr result (*visit_table[])(functor&) = {
+    &visit_entry<functor, result, types>...};
+
+// For more than one list, the table is flattened in row-major order.
+// So, the last list is the one with the smallest stride.
+// For every flat index, the indices into all lists are recovered
+// and the respective types are gathered from all lists at once.
+//
+template <size_t... sizes>
+consteval auto unflatten(size_t index) {
+  std::array<size_t, sizeof...(sizes)> result{};
+  const std::array<size_t, sizeof...(sizes)> radix{sizes...};
+  for (size_t i = sizeof...(sizes); i-- > 0;) {
+    result[i] = index % radix[i];
+    index /= radix[i];
+  }
+  return result;
+}
+//
+template <size_t n>
+consteval auto iota() {
+  std::array<size_t, n> result{};
+  for (size_t i = 0; i < n; ++i) result[i] = i;
+  return result;
+}
+//
+template <typename functor, typename result, typename... lists>
+inline constexpr auto multi_visit_table =
+    []<size_t... k>(std::index_sequence<k...>) {
+      return std::array<result (*)(functor&), sizeof...(k)>{
+          visit_entry_for<functor,
+                          result,
+                          decltype(gather_nested<
+                                   iota<sizeof...(lists)>(),
+                                   unflatten<size(lists{})...>(k)>(
+                              lists{}...))>...};
+    }(std::make_index_sequence<(size(lists{}) * ...)>{});
+}  // namespace detail
+
+/// Call the given function object for the type at a runtime index
+/// inside a 'type_list' instance.
+/// The type is given as template argument 'f.template operator()<type>()'.
+/// All calls have to return the same type.
+///
+template <typename type, typename... types>
+constexpr decltype(auto) visit(type_list<type, types...>,
+                               size_t index,
+                               auto&& f)
+  requires(meta::equal<decltype(f.template operator()<type>()),
+                       decltype(f.template operator()<types>())> &&
+           ...)
+{
+  using functor = std::remove_reference_t<decltype(f)>;
+  using result = decltype(f.template operator()<type>());
+  assert(index <= sizeof...(types));
+  return detail::visit_table<functor, result, type, types...>[index](f);
+}
+
+/// Call the given function object for a combination of types
+/// given by a runtime index for each of the given 'type_list' instances.
+/// The types are given as template arguments in the order of the lists.
+/// Only one flattened table is used for all combinations.
+///
+template <instance::type_list... lists>
+constexpr decltype(auto) visit(
+    type_list<lists...>,
+    const std::array<size_t, sizeof...(lists)>& indices,
+    auto&& f)
+  requires((sizeof...(lists) > 0) && (!empty(lists{}) && ...))
+{
+  using functor = std::remove_reference_t<decltype(f)>;
+  using result =
+      decltype(f.template operator()<decltype(front(lists{}))...>());
+  constexpr std::array<size_t, sizeof...(lists)> sizes{size(lists{})...};
+  size_t index = 0;
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    assert(indices[i] < sizes[i]);
+    index = index * sizes[i] + indices[i];
+  }
+  return detail::multi_visit_table<functor, result, lists...>[index](f);
 }
 
 }  // namespace lyra::xstd
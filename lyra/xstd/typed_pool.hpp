@@ -0,0 +1,344 @@
+#pragma once
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <span>
+#include <tuple>
+#include <vector>
+//
+#include <lyra/xstd/type_list.hpp>
+
+namespace lyra::xstd {
+
+/// The statistics of a single pool inside a 'typed_pool'.
+/// If size classes are merged, all types of the same class
+/// share their pool and, as such, their statistics.
+///
+struct pool_statistics {
+  size_t slot_size;
+  size_t slot_alignment;
+  size_t slabs;
+  size_t capacity;
+  size_t used;
+  size_t allocations;
+  size_t deallocations;
+};
+
+// Every pool hands out slots of a fixed size and alignment.
+// Slots are carved from slabs whose sizes grow geometrically.
+// Free slots are linked together by a singly linked list
+// that is stored inside the slots themselves.
+// So, allocating and deallocating a single slot
+// is only a pointer exchange without any search.
+//
+namespace detail {
+struct size_class {
+  size_t size;
+  size_t alignment;
+
+  friend constexpr bool operator==(const size_class&,
+                                   const size_class&) = default;
+};
+
+// Every slot must be able to store the free list link.
+// Its size is a multiple of its alignment such that
+// consecutive slots inside a slab stay aligned.
+//
+template <typename type>
+consteval auto slot_class() {
+  const auto alignment = std::max(alignof(type), alignof(void*));
+  const auto size = std::max(sizeof(type), sizeof(void*));
+  return size_class{(size + alignment - 1) / alignment * alignment, alignment};
+}
+
+// Without merging, every type gets its own pool.
+// With merging, all types of the same size class share the pool
+// of the first type of that class.
+// Pools are numbered in the order of their first occurrence.
+//
+template <auto classes, bool merge>
+consteval auto pool_indices() {
+  std::array<size_t, classes.size()> result{};
+  for (size_t i = 0, count = 0; i < classes.size(); ++i) {
+    result[i] = count;
+    for (size_t j = 0; merge && (j < i); ++j) {
+      if (classes[j] != classes[i]) continue;
+      result[i] = result[j];
+      break;
+    }
+    if (result[i] == count) ++count;
+  }
+  return result;
+}
+//
+template <auto indices>
+consteval auto pool_count() {
+  size_t result = 0;
+  for (auto i : indices) result = std::max(result, i + 1);
+  return result;
+}
+//
+template <auto classes, auto indices>
+consteval auto pool_classes() {
+  std::array<size_class, pool_count<indices>()> result{};
+  for (size_t i = classes.size(); i-- > 0;) result[indices[i]] = classes[i];
+  return result;
+}
+
+template <size_t size, size_t alignment>
+class slab_pool {
+  struct node {
+    node* next;
+  };
+
+ public:
+  /// The first slab spans at least a page.
+  /// Every following slab doubles the capacity of the pool.
+  ///
+  static constexpr size_t min_slab_slots =
+      std::max(size_t{4096} / size, size_t{1});
+
+  slab_pool() noexcept = default;
+
+  slab_pool(const slab_pool&) = delete;
+  slab_pool& operator=(const slab_pool&) = delete;
+
+  slab_pool(slab_pool&& x) noexcept
+      : slabs{std::move(x.slabs)},
+        head{std::exchange(x.head, nullptr)},
+        free{std::exchange(x.free, 0)},
+        slots{std::exchange(x.slots, 0)},
+        allocations{std::exchange(x.allocations, 0)},
+        deallocations{std::exchange(x.deallocations, 0)} {
+    x.slabs.clear();
+  }
+
+  slab_pool& operator=(slab_pool&& x) noexcept {
+    slab_pool tmp{std::move(x)};
+    swap(tmp);
+    return *this;
+  }
+
+  ~slab_pool() noexcept {
+    for (auto slab : slabs)
+      ::operator delete(slab, std::align_val_t{alignment});
+  }
+
+  void swap(slab_pool& x) noexcept {
+    std::swap(slabs, x.slabs);
+    std::swap(head, x.head);
+    std::swap(free, x.free);
+    std::swap(slots, x.slots);
+    std::swap(allocations, x.allocations);
+    std::swap(deallocations, x.deallocations);
+  }
+
+  void* allocate() {
+    if (!head) grow(1);
+    ++allocations;
+    return pop();
+  }
+
+  void deallocate(void* ptr) noexcept {
+    assert(ptr);
+    ++deallocations;
+    push(ptr);
+  }
+
+  // For bulk operations, the pool grows at most once
+  // and the loops are free of any further checks.
+  //
+  template <typename type>
+  void allocate(std::span<type*> ptrs) {
+    reserve(ptrs.size());
+    allocations += ptrs.size();
+    for (auto& ptr : ptrs) ptr = static_cast<type*>(pop());
+  }
+  //
+  template <typename type>
+  void deallocate(std::span<type* const> ptrs) noexcept {
+    deallocations += ptrs.size();
+    for (auto ptr : ptrs) push(ptr);
+  }
+
+  void reserve(size_t n) {
+    if (free < n) grow(n - free);
+  }
+
+  auto statistics() const noexcept {
+    return pool_statistics{
+        .slot_size = size,
+        .slot_alignment = alignment,
+        .slabs = slabs.size(),
+        .capacity = slots,
+        .used = slots - free,
+        .allocations = allocations,
+        .deallocations = deallocations,
+    };
+  }
+
+ private:
+  void* pop() noexcept {
+    assert(head);
+    const auto result = head;
+    head = head->next;
+    --free;
+    return result;
+  }
+
+  void push(void* ptr) noexcept {
+    head = ::new (ptr) node{head};
+    ++free;
+  }
+
+  // The slots of a new slab are linked in increasing address order.
+  // So, consecutive allocations return consecutive memory.
+  //
+  void grow(size_t n) {
+    const auto count = std::max({n, slots, min_slab_slots});
+    slabs.reserve(slabs.size() + 1);
+    const auto slab = static_cast<std::byte*>(
+        ::operator new(count * size, std::align_val_t{alignment}));
+    slabs.push_back(slab);
+    for (size_t i = count; i-- > 0;) push(slab + i * size);
+    slots += count;
+  }
+
+  std::vector<std::byte*> slabs{};
+  node* head = nullptr;
+  size_t free = 0;
+  size_t slots = 0;
+  size_t allocations = 0;
+  size_t deallocations = 0;
+};
+
+template <auto classes, size_t... indices>
+auto slab_pools(std::index_sequence<indices...>)
+    -> std::tuple<slab_pool<classes[indices].size,
+                            classes[indices].alignment>...>;
+}  // namespace detail
+
+/// The template 'typed_pool' is an allocator for objects
+/// whose types are given by a 'type_list' instance.
+/// Every type is served by its own slab pool
+/// that is selected at compile time by the index of the type.
+/// So, there is no hashing and no lookup at runtime.
+/// If 'merge_size_classes' is set, types with the same size and alignment
+/// share a single pool to reduce the number of partially used slabs.
+/// The pool does not keep track of constructed objects.
+/// All objects have to be destroyed before the pool is destroyed.
+///
+template <instance::type_list list, bool merge_size_classes = false>
+class typed_pool;
+
+template <typename... types, bool merge_size_classes>
+class typed_pool<type_list<types...>, merge_size_classes> {
+  static constexpr std::array<detail::size_class, sizeof...(types)>
+      type_classes{detail::slot_class<types>()...};
+  static constexpr auto indices =
+      detail::pool_indices<type_classes, merge_size_classes>();
+  static constexpr auto classes = detail::pool_classes<type_classes, indices>();
+
+  using pools_type = decltype(detail::slab_pools<classes>(
+      std::make_index_sequence<classes.size()>{}));
+
+ public:
+  using value_types = type_list<types...>;
+
+  static constexpr size_t pool_count = classes.size();
+
+  /// Returns the index of the pool that serves the given type.
+  ///
+  template <typename type>
+    requires(contains<type>(value_types{}))
+  static constexpr size_t pool_index = indices[index_of<type>(value_types{})];
+
+  /// Allocate uninitialized storage for a single object of the given type.
+  ///
+  template <typename type>
+    requires(contains<type>(value_types{}))
+  auto allocate() -> type* {
+    return static_cast<type*>(pool<type>().allocate());
+  }
+
+  /// Release the storage of a single object of the given type.
+  /// The object has to be destroyed before.
+  ///
+  template <typename type>
+    requires(contains<type>(value_types{}))
+  void deallocate(type* ptr) noexcept {
+    pool<type>().deallocate(ptr);
+  }
+
+  /// Allocate uninitialized storage for many objects of the given type
+  /// and write their addresses into the given range.
+  /// The pool grows at most once.
+  ///
+  template <typename type>
+    requires(contains<type>(value_types{}))
+  void allocate(std::span<type*> ptrs) {
+    pool<type>().allocate(ptrs);
+  }
+
+  /// Release the storage of many objects of the given type.
+  ///
+  template <typename type>
+    requires(contains<type>(value_types{}))
+  void deallocate(std::span<type* const> ptrs) noexcept {
+    pool<type>().deallocate(ptrs);
+  }
+
+  /// Allocate storage for an object of the given type
+  /// and construct it in place from the given arguments.
+  ///
+  template <typename type, typename... args>
+    requires(contains<type>(value_types{})) &&
+            std::constructible_from<type, args&&...>
+  auto create(args&&... values) -> type* {
+    const auto ptr = allocate<type>();
+    try {
+      return std::construct_at(ptr, std::forward<args>(values)...);
+    } catch (...) {
+      deallocate(ptr);
+      throw;
+    }
+  }
+
+  /// Destroy an object that has been created by the pool
+  /// and release its storage.
+  ///
+  template <typename type>
+    requires(contains<type>(value_types{}))
+  void destroy(type* ptr) noexcept {
+    if (!ptr) return;
+    std::destroy_at(ptr);
+    deallocate(ptr);
+  }
+
+  /// Make sure that at least 'n' objects of the given type
+  /// can be allocated without growing the pool.
+  ///
+  template <typename type>
+    requires(contains<type>(value_types{}))
+  void reserve(size_t n) {
+    pool<type>().reserve(n);
+  }
+
+  /// Returns the statistics of the pool that serves the given type.
+  ///
+  template <typename type>
+    requires(contains<type>(value_types{}))
+  auto statistics() const noexcept {
+    return std::get<pool_index<type>>(pools).statistics();
+  }
+
+ private:
+  template <typename type>
+  auto& pool() noexcept {
+    return std::get<pool_index<type>>(pools);
+  }
+
+  pools_type pools{};
+};
+
+}  // namespace lyra::xstd
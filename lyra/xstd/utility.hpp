@@ -22,6 +22,7 @@
 #include <functional>
 #include <type_traits>
 #include <typeinfo>
+#include <utility>
 
 // We will always need to handle runtime errors.
 // For that, also standard string functions are required.
@@ -29,6 +30,17 @@
 #include <stdexcept>
 #include <string>
 
+// Compiler builtins may provide faster implementations
+// for some of the facilities in this library.
+// Not every compiler supports '__has_builtin'.
+// So, we provide a wrapper that is always usable inside '#if' directives.
+//
+#if defined(__has_builtin)
+#define LYRA_XSTD_HAS_BUILTIN(x) __has_builtin(x)
+#else
+#define LYRA_XSTD_HAS_BUILTIN(x) 0
+#endif
+
 namespace lyra::xstd {
 
 // The names 'float' and 'double' are rather inconsistent.
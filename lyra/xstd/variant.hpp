@@ -0,0 +1,278 @@
+#pragma once
+#include <algorithm>
+#include <memory>
+#include <new>
+//
+#include <lyra/xstd/type_list.hpp>
+
+namespace lyra::xstd {
+
+/// The template 'variant' is a tagged union
+/// whose alternatives are given by a 'type_list' instance.
+/// In contrast to 'std::variant', the discriminator is the smallest
+/// unsigned integer type that is able to store all alternative indices.
+/// The storage is a single aligned byte buffer without recursive unions.
+/// A 'variant' is never valueless.
+///
+template <instance::type_list list>
+class variant;
+
+template <typename type, typename... types>
+class variant<type_list<type, types...>> {
+  // Assignments destroy the old value before constructing the new one.
+  // To never end up without a value, moves must not throw.
+  static_assert((std::is_nothrow_move_constructible_v<type> && ... &&
+                 std::is_nothrow_move_constructible_v<types>));
+  static_assert((std::is_nothrow_destructible_v<type> && ... &&
+                 std::is_nothrow_destructible_v<types>));
+  static_assert(sizeof...(types) < 65536,
+                "Too many alternatives for a 16-bit discriminator.");
+
+  // Alternatives can only be selected by their type if it is unique.
+  //
+  template <typename t>
+  static constexpr bool unique =
+      (size_t{meta::equal<t, type>} + ... + size_t{meta::equal<t, types>}) ==
+      1;
+
+  // For trivial alternatives, all special member functions are trivial.
+  // Then, a 'variant' can be copied by a plain 'memcpy'.
+  //
+  static constexpr bool trivially_copyable =
+      (std::is_trivially_copyable_v<type> && ... &&
+       std::is_trivially_copyable_v<types>);
+
+ public:
+  using alternatives = type_list<type, types...>;
+
+  template <size_t i>
+  using alternative = decltype(element<i>(alternatives{}));
+
+  static constexpr size_t alternative_count = 1 + sizeof...(types);
+
+  /// The discriminator type is chosen by the number of alternatives.
+  ///
+  using index_type =
+      std::conditional_t<(alternative_count <= 256), uint8, uint16>;
+
+  static constexpr size_t storage_size =
+      std::max({sizeof(type), sizeof(types)...});
+  static constexpr size_t storage_alignment =
+      std::max({alignof(type), alignof(types)...});
+
+  /// By default, the first alternative is value-initialized.
+  ///
+  variant() noexcept(std::is_nothrow_default_constructible_v<type>)
+    requires std::default_initializable<type>
+  {
+    std::construct_at(pointer<type>());
+  }
+
+  /// Construct the alternative with the given index in place.
+  ///
+  template <size_t i, typename... args>
+    requires(i < alternative_count) &&
+            std::constructible_from<alternative<i>, args&&...>
+  explicit variant(std::in_place_index_t<i>, args&&... values)
+      : tag{i} {
+    std::construct_at(pointer<alternative<i>>(), std::forward<args>(values)...);
+  }
+
+  /// Construct the alternative whose type is exactly the given one.
+  /// No implicit conversions are considered to select the alternative.
+  /// So, the type has to be unique inside the alternatives.
+  ///
+  template <typename value_type>
+    requires(unique<std::remove_cvref_t<value_type>>)
+  variant(value_type&& value)
+      : variant{std::in_place_index<index_of<std::remove_cvref_t<value_type>>(
+                    alternatives{})>,
+                std::forward<value_type>(value)} {}
+
+  variant(const variant&) = default;
+  variant(const variant& x)
+    requires(!trivially_copyable)
+      : tag{x.tag} {
+    x.dispatch(
+        [&]<typename t> { std::construct_at(pointer<t>(), *x.pointer<t>()); });
+  }
+
+  variant(variant&&) = default;
+  variant(variant&& x) noexcept
+    requires(!trivially_copyable)
+      : tag{x.tag} {
+    x.dispatch([&]<typename t> {
+      std::construct_at(pointer<t>(), std::move(*x.pointer<t>()));
+    });
+  }
+
+  variant& operator=(const variant&) = default;
+  variant& operator=(const variant& x)
+    requires(!trivially_copyable)
+  {
+    if (this == &x) return *this;
+    variant copy{x};
+    return *this = std::move(copy);
+  }
+
+  variant& operator=(variant&&) = default;
+  variant& operator=(variant&& x) noexcept
+    requires(!trivially_copyable)
+  {
+    if (this == &x) return *this;
+    destroy();
+    tag = x.tag;
+    x.dispatch([&]<typename t> {
+      std::construct_at(pointer<t>(), std::move(*x.pointer<t>()));
+    });
+    return *this;
+  }
+
+  ~variant() = default;
+  ~variant() noexcept
+    requires(!trivially_copyable)
+  {
+    destroy();
+  }
+
+  /// Returns the index of the currently stored alternative.
+  ///
+  constexpr size_t index() const noexcept { return tag; }
+
+  /// Check whether the alternative with the given index or type is stored.
+  ///
+  template <size_t i>
+  bool holds() const noexcept {
+    return tag == i;
+  }
+  //
+  template <typename t>
+    requires(unique<t>)
+  bool holds() const noexcept {
+    return tag == index_of<t>(alternatives{});
+  }
+
+  /// Access the stored value by the index of its alternative.
+  /// The alternative must currently be stored.
+  ///
+  template <size_t i>
+  auto get() & noexcept -> alternative<i>& {
+    assert(holds<i>());
+    return *pointer<alternative<i>>();
+  }
+  //
+  template <size_t i>
+  auto get() const& noexcept -> const alternative<i>& {
+    assert(holds<i>());
+    return *pointer<alternative<i>>();
+  }
+  //
+  template <size_t i>
+  auto get() && noexcept -> alternative<i>&& {
+    assert(holds<i>());
+    return std::move(*pointer<alternative<i>>());
+  }
+
+  /// Access the stored value by the type of its alternative.
+  /// The type has to be unique inside the alternatives.
+  ///
+  template <typename t>
+    requires(unique<t>)
+  auto get() & noexcept -> t& {
+    return get<index_of<t>(alternatives{})>();
+  }
+  //
+  template <typename t>
+    requires(unique<t>)
+  auto get() const& noexcept -> const t& {
+    return get<index_of<t>(alternatives{})>();
+  }
+  //
+  template <typename t>
+    requires(unique<t>)
+  auto get() && noexcept -> t&& {
+    return std::move(*this).template get<index_of<t>(alternatives{})>();
+  }
+
+  /// Destroy the stored value and construct
+  /// the alternative with the given index in place.
+  /// If the construction may throw, the new value is constructed
+  /// before the old one is destroyed to keep the variant valid.
+  ///
+  template <size_t i, typename... args>
+    requires(i < alternative_count) &&
+            std::constructible_from<alternative<i>, args&&...>
+  auto emplace(args&&... values) -> alternative<i>& {
+    using t = alternative<i>;
+    if constexpr (std::is_nothrow_constructible_v<t, args&&...>) {
+      destroy();
+      std::construct_at(pointer<t>(), std::forward<args>(values)...);
+    } else {
+      t value(std::forward<args>(values)...);
+      destroy();
+      std::construct_at(pointer<t>(), std::move(value));
+    }
+    tag = i;
+    return *pointer<t>();
+  }
+  //
+  template <typename t, typename... args>
+    requires(unique<t>)
+  auto emplace(args&&... values) -> t& {
+    return emplace<index_of<t>(alternatives{})>(std::forward<args>(values)...);
+  }
+
+  /// Call the given function object with the stored value.
+  /// The dispatch is done by a single indirect call through a jump table.
+  /// For a single alternative, no dispatch is needed at all.
+  ///
+  decltype(auto) visit(auto&& f) & {
+    return dispatch([&]<typename t>() -> decltype(auto) {
+      return std::invoke(f, *pointer<t>());
+    });
+  }
+  //
+  decltype(auto) visit(auto&& f) const& {
+    return dispatch([&]<typename t>() -> decltype(auto) {
+      return std::invoke(f, *pointer<t>());
+    });
+  }
+  //
+  decltype(auto) visit(auto&& f) && {
+    return dispatch([&]<typename t>() -> decltype(auto) {
+      return std::invoke(f, std::move(*pointer<t>()));
+    });
+  }
+
+ private:
+  template <typename t>
+  auto pointer() noexcept {
+    return std::launder(reinterpret_cast<t*>(storage));
+  }
+  //
+  template <typename t>
+  auto pointer() const noexcept {
+    return std::launder(reinterpret_cast<const t*>(storage));
+  }
+
+  // Call 'f.template operator()<t>()' for the type 't'
+  // of the currently stored alternative.
+  //
+  decltype(auto) dispatch(auto&& f) const {
+    if constexpr (alternative_count == 1)
+      return f.template operator()<type>();
+    else
+      return xstd::visit(alternatives{}, tag, f);
+  }
+
+  void destroy() noexcept {
+    if constexpr (!(std::is_trivially_destructible_v<type> && ... &&
+                    std::is_trivially_destructible_v<types>))
+      dispatch([&]<typename t> { std::destroy_at(pointer<t>()); });
+  }
+
+  alignas(storage_alignment) std::byte storage[storage_size];
+  index_type tag{};
+};
+
+}  // namespace lyra::xstd
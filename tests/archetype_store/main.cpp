@@ -0,0 +1,93 @@
+#include <cassert>
+#include <string>
+//
+#include <lyra/xstd/archetype_store.hpp>
+
+using lyra::xstd::archetype_store;
+using lyra::xstd::canonical_components;
+using lyra::xstd::entity;
+using lyra::xstd::type_list;
+using lyra::xstd::meta::equal;
+
+struct position {
+  float x, y;
+};
+struct velocity {
+  float x, y;
+};
+struct name {
+  std::string value;
+};
+
+// Permutations and duplicates of components are canonicalized.
+//
+static_assert(canonical_components(type_list<position, velocity>{}) ==
+              canonical_components(type_list<velocity, position>{}));
+static_assert(canonical_components(type_list<name, position, name>{}) ==
+              canonical_components(type_list<position, name>{}));
+static_assert(canonical_components(type_list<>{}) == type_list<>{});
+
+using store = archetype_store<type_list<type_list<position, velocity>,
+                                        type_list<velocity, position>,
+                                        type_list<position>,
+                                        type_list<name, position, velocity>>>;
+
+static_assert(store::archetype_count == 3);
+static_assert(store::archetype_index<type_list<position, velocity>> ==
+              store::archetype_index<type_list<velocity, position>>);
+static_assert(store::archetype_index<type_list<velocity>> ==
+              store::archetype_count);
+
+int main() {
+  store s{};
+  assert(s.size() == 0);
+
+  // Components may be given in any order.
+  //
+  const auto a = s.create(position{0, 0}, velocity{1, 2});
+  const auto b = s.create(velocity{3, 4}, position{1, 1});
+  const auto c = s.create(position{5, 5});
+  const auto d = s.create(name{"d"}, velocity{1, 1}, position{2, 2});
+  assert(s.size() == 4);
+  assert((s.size<type_list<velocity, position>>() == 2));
+  assert((s.size<type_list<position>>() == 1));
+
+  assert(s.get<velocity>(b)->x == 3);
+  assert(s.get<velocity>(c) == nullptr);
+  assert(s.get<name>(d)->value == "d");
+
+  // Queries only visit entities that own all queried components.
+  //
+  s.for_each<velocity, position>([](velocity& v, position& p) {
+    p.x += v.x;
+    p.y += v.y;
+  });
+  assert(s.get<position>(a)->x == 1);
+  assert(s.get<position>(b)->y == 5);
+  assert(s.get<position>(c)->x == 5);
+  assert(s.get<position>(d)->x == 3);
+
+  int count = 0;
+  s.for_each<position>([&](const position&) { ++count; });
+  assert(count == 4);
+  count = 0;
+  s.for_each<name>([&](name& n) {
+    assert(n.value == "d");
+    ++count;
+  });
+  assert(count == 1);
+
+  // Destroying an entity moves the last row of its table.
+  // Handles of other entities stay valid and identifiers are reused.
+  //
+  s.destroy(a);
+  assert(s.size() == 3);
+  assert((s.size<type_list<position, velocity>>() == 1));
+  assert(s.get<velocity>(b)->y == 4);
+  const auto e = s.create(position{7, 7});
+  assert(e == a);
+  assert(s.get<position>(e)->x == 7);
+  assert(s.get<position>(c)->x == 5);
+  s.destroy(c);
+  assert(s.get<position>(e)->y == 7);
+}
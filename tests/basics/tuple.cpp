@@ -0,0 +1,49 @@
+#include <lyra/xstd/tuple.hpp>
+
+using lyra::xstd::tuple;
+using lyra::xstd::type_list;
+using lyra::xstd::meta::equal;
+
+// The elements are physically ordered by decreasing alignment.
+// So, the padding is minimized.
+//
+static_assert(sizeof(tuple<type_list<char, double, char, int>>) == 16);
+static_assert(sizeof(std::tuple<char, double, char, int>) >= 16);
+static_assert(sizeof(tuple<type_list<char, int, char, int, char>>) == 12);
+static_assert(sizeof(tuple<type_list<double, char>>) == 16);
+static_assert(sizeof(tuple<type_list<char>>) == 1);
+static_assert(alignof(tuple<type_list<char, double>>) == alignof(double));
+
+// Elements are accessed by their logical index.
+//
+constexpr auto x = tuple<type_list<char, double, short, int>>{'a', 1.5, 2, 3};
+static_assert(get<0>(x) == 'a');
+static_assert(get<1>(x) == 1.5);
+static_assert(get<2>(x) == 2);
+static_assert(get<3>(x) == 3);
+static_assert(equal<decltype(get<0>(x)), const char&>);
+static_assert(equal<decltype(get<1>(x)), const double&>);
+
+// Equal types are stored as distinct elements.
+//
+constexpr auto y = tuple{1, 'b', 2, 'c'};
+static_assert(equal<decltype(y), const tuple<type_list<int, char, int, char>>>);
+static_assert(get<0>(y) == 1);
+static_assert(get<1>(y) == 'b');
+static_assert(get<2>(y) == 2);
+static_assert(get<3>(y) == 'c');
+
+// Tuples can be compared, modified, and decomposed.
+//
+static_assert(tuple{1, 'b'} == tuple{1, 'b'});
+static_assert(tuple{1, 'b'} != tuple{1, 'c'});
+static_assert([] {
+  tuple<type_list<char, long>> t{};
+  get<1>(t) = 7;
+  get<0>(t) = 'z';
+  auto [c, l] = t;
+  return (c == 'z') && (l == 7);
+}());
+static_assert(std::tuple_size_v<tuple<type_list<int, char>>> == 2);
+static_assert(
+    equal<std::tuple_element_t<1, tuple<type_list<int, char>>>, char>);
@@ -95,6 +95,61 @@ static_assert(equal<decltype(element<0>(type_list<double, int, char>{})),  //
 static_assert(equal<decltype(element<1>(type_list<double, int, char>{})), int>);
 static_assert(equal<decltype(element<2>(type_list<double, int, char>{})),  //
                     char>);
+static_assert(equal<decltype(element<1>(type_list<int, void, char>{})), void>);
+static_assert(equal<decltype(element<1>(type_list<int, char&, char>{})),  //
+                    char&>);
+
+// The access of types does not depend on recursion.
+// So, large type lists do not exceed the template instantiation depth.
+//
+template <size_t index>
+struct tag {};
+template <size_t... indices>
+consteval auto make_tags(std::index_sequence<indices...>) {
+  return type_list<tag<indices>...>{};
+}
+constexpr auto tags = make_tags(std::make_index_sequence<2048>{});
+static_assert(equal<decltype(element<0>(tags)), tag<0>>);
+static_assert(equal<decltype(element<1234>(tags)), tag<1234>>);
+static_assert(equal<decltype(element<2047>(tags)), tag<2047>>);
+static_assert(equal<decltype(back(tags)), tag<2047>>);
+static_assert(slice<1000>(tags) == type_list<tag<1000>>{});
+
+// Find the position of types inside a 'type_list' instance.
+//
+static_assert(index_of<int>(type_list<>{}) == 0);
+static_assert(index_of<int>(type_list<int>{}) == 0);
+static_assert(index_of<int>(type_list<char>{}) == 1);
+static_assert(index_of<int>(type_list<char, int>{}) == 1);
+static_assert(index_of<int>(type_list<int, char, int>{}) == 0);
+static_assert(index_of<float>(type_list<int, char, int>{}) == 3);
+static_assert(index_of<tag<1234>>(tags) == 1234);
+//
+static_assert(find_if(type_list<>{}, correct_alignment) == 0);
+static_assert(find_if(type_list<char>{}, correct_alignment) == 1);
+static_assert(find_if(type_list<float>{}, correct_alignment) == 0);
+static_assert(find_if(type_list<char, short, float>{}, correct_alignment) ==
+              2);
+static_assert(find_if(type_list<char, double, float>{}, correct_alignment) ==
+              1);
+
+// Count the types for which a predicate holds.
+//
+static_assert(count_if(type_list<>{}, correct_alignment) == 0);
+static_assert(count_if(type_list<char>{}, correct_alignment) == 0);
+static_assert(count_if(type_list<float>{}, correct_alignment) == 1);
+static_assert(count_if(type_list<char, double, short, float>{},
+                       correct_alignment) == 2);
+static_assert(count_if(tags, []<typename x> { return true; }) == 2048);
+
+// Get the positions of all types for which a predicate holds.
+//
+static_assert(indices_if(type_list<>{}, correct_alignment).size() == 0);
+static_assert(indices_if(type_list<char>{}, correct_alignment).size() == 0);
+static_assert(indices_if(type_list<float>{}, correct_alignment) ==
+              std::array<size_t, 1>{0});
+static_assert(indices_if(type_list<char, double, short, float>{},
+                         correct_alignment) == std::array<size_t, 2>{1, 3});
 
 // Access the types wrapped by a 'type_list' given their index.
 //
@@ -179,6 +234,33 @@ static_assert(type_list<char, float>{} + type_list<int>{} ==
               type_list<char, float, int>{});
 static_assert(type_list<float>{} + type_list<char, int>{} ==
               type_list<float, char, int>{});
+//
+static_assert(lyra::xstd::concat() == type_list<>{});
+static_assert(concat(type_list<int>{}) == type_list<int>{});
+static_assert(concat(type_list<>{}, type_list<>{}, type_list<>{}) ==
+              type_list<>{});
+static_assert(concat(type_list<int>{}, type_list<>{}, type_list<char>{}) ==
+              type_list<int, char>{});
+static_assert(concat(type_list<int, char>{},
+                     type_list<float>{},
+                     type_list<>{},
+                     type_list<double, short>{}) ==
+              type_list<int, char, float, double, short>{});
+static_assert(concat(range<0, 1000>(tags), range<1000, 2048>(tags)) == tags);
+static_assert(concat(range<0, 10>(tags),
+                     range<10, 1000>(tags),
+                     range<1000, 2048>(tags)) == tags);
+
+// Concatenate all 'type_list' instances inside a 'type_list' instance.
+//
+static_assert(join(type_list<>{}) == type_list<>{});
+static_assert(join(type_list<type_list<>>{}) == type_list<>{});
+static_assert(join(type_list<type_list<int>, type_list<>>{}) ==
+              type_list<int>{});
+static_assert(join(type_list<type_list<int, char>, type_list<float>>{}) ==
+              type_list<int, char, float>{});
+static_assert(join(type_list<type_list<int>, type_list<type_list<char>>>{}) ==
+              type_list<int, type_list<char>>{});
 
 // Pop an element from the front.
 //
@@ -218,6 +300,10 @@ static_assert(~type_list<char>{} == type_list<char>{});
 static_assert(~type_list<int, char>{} == type_list<char, int>{});
 static_assert(~type_list<char, int>{} == type_list<int, char>{});
 static_assert(~type_list<char, int, float>{} == type_list<float, int, char>{});
+//
+static_assert(~~tags == tags);
+static_assert(slice<0>(~tags) == type_list<tag<2047>>{});
+static_assert(slice<2047>(~tags) == type_list<tag<0>>{});
 
 // Insert types at a specific position.
 //
@@ -230,6 +316,7 @@ static_assert(insert<1, float>(type_list<int, char>{}) ==
               type_list<int, float, char>{});
 static_assert(insert<2, float>(type_list<int, char>{}) ==
               type_list<int, char, float>{});
+static_assert(remove<1000>(insert<1000, void>(tags)) == tags);
 
 // Insert types by using a predicate.
 //
@@ -254,6 +341,8 @@ static_assert(remove<1>(type_list<float, int, char>{}) ==
               type_list<float, char>{});
 static_assert(remove<2>(type_list<float, int, char>{}) ==
               type_list<float, int>{});
+static_assert(size(remove<1000>(tags)) == 2047);
+static_assert(slice<1000>(remove<1000>(tags)) == type_list<tag<1001>>{});
 
 // Remove types by using a predicate.
 //
@@ -268,6 +357,33 @@ static_assert(remove(type_list<short, char>{}, too_big) ==
               type_list<short, char>{});
 static_assert(remove(type_list<int, unsigned, char, short>{}, too_big) ==
               type_list<char, short>{});
+static_assert(size(remove(tags, []<typename x> { return true; })) == 0);
+static_assert(remove(tags, []<typename x> { return !equal<x, tag<7>>; }) ==
+              type_list<tag<7>>{});
+
+// Remove duplicates by keeping their first occurrence.
+//
+static_assert(unique(type_list<>{}) == type_list<>{});
+static_assert(unique(type_list<int>{}) == type_list<int>{});
+static_assert(unique(type_list<int, int>{}) == type_list<int>{});
+static_assert(unique(type_list<int, char, int, char, short>{}) ==
+              type_list<int, char, short>{});
+static_assert(unique(tags) == tags);
+static_assert(unique(tags + tags) == tags);
+
+// Keep types by using a predicate.
+//
+static_assert(filter(type_list<>{}, too_big) == type_list<>{});
+static_assert(filter(type_list<char>{}, too_big) == type_list<>{});
+static_assert(filter(type_list<int>{}, too_big) == type_list<int>{});
+static_assert(filter(type_list<char, int>{}, too_big) == type_list<int>{});
+static_assert(filter(type_list<int, char>{}, too_big) == type_list<int>{});
+static_assert(filter(type_list<int, unsigned>{}, too_big) ==
+              type_list<int, unsigned>{});
+static_assert(filter(type_list<short, char>{}, too_big) == type_list<>{});
+static_assert(filter(type_list<int, unsigned, char, short>{}, too_big) ==
+              type_list<int, unsigned>{});
+static_assert(filter(tags, []<typename x> { return true; }) == tags);
 //
 // static_assert(remove(type_list<char, short, int, unsigned, float>{},
 //                      []<size_t i, typename type> { return (i % 2) != 0; }) ==
@@ -328,6 +444,10 @@ static_assert(range<0, 2>(type_list<int, char, float>{}) ==
               type_list<int, char>{});
 static_assert(range<1, 3>(type_list<int, char, float>{}) ==
               type_list<char, float>{});
+//
+static_assert(size(range<1000, 2000>(tags)) == 1000);
+static_assert(range<1000, 2000>(tags) == trim_back<48>(trim_front<1000>(tags)));
+static_assert(back_slice(pop_back(tags)) == type_list<tag<2046>>{});
 
 // Swap two elements.
 //
@@ -356,6 +476,9 @@ static_assert(swap<2, 1>(type_list<int, char, float>{}) ==
               type_list<int, float, char>{});
 static_assert(swap<2, 2>(type_list<int, char, float>{}) ==
               type_list<int, char, float>{});
+//
+static_assert(slice<0>(swap<0, 2047>(tags)) == type_list<tag<2047>>{});
+static_assert(slice<2047>(swap<0, 2047>(tags)) == type_list<tag<0>>{});
 
 // Merge two sorted 'type_list' instances.
 //
@@ -432,6 +555,30 @@ static_assert(sort(type_list<short, unsigned, char, int>{},
                      return sizeof(x) > sizeof(y);
                    }) == type_list<int, unsigned, short, char>{});
 
+// Sort a list of types while preserving the order of equivalent types.
+//
+constexpr auto strict_less = []<typename x, typename y> {
+  return sizeof(x) < sizeof(y);
+};
+static_assert(stable_sort(type_list<>{}, strict_less) == type_list<>{});
+static_assert(stable_sort(type_list<int>{}, strict_less) == type_list<int>{});
+static_assert(stable_sort(type_list<int, char>{}, strict_less) ==
+              type_list<char, int>{});
+static_assert(stable_sort(type_list<unsigned, int>{}, strict_less) ==
+              type_list<unsigned, int>{});
+static_assert(stable_sort(type_list<int, unsigned>{}, strict_less) ==
+              type_list<int, unsigned>{});
+static_assert(stable_sort(type_list<short, unsigned, char, int>{},
+                          strict_less) ==
+              type_list<char, short, unsigned, int>{});
+static_assert(stable_sort(type_list<short, unsigned, char, int>{},
+                          []<typename x, typename y> {
+                            return sizeof(x) > sizeof(y);
+                          }) == type_list<unsigned, int, short, char>{});
+static_assert(stable_sort(type_list<int, char, unsigned, short, char>{},
+                          strict_less) ==
+              type_list<char, char, short, int, unsigned>{});
+
 // Transform
 //
 static_assert(transform(type_list<float, void, int>{}, []<typename x> {
@@ -440,3 +587,51 @@ static_assert(transform(type_list<float, void, int>{}, []<typename x> {
                 else
                   return type_list<x>{};
               }) == type_list<float, type_list<>, int>{});
+static_assert(transform(type_list<>{}, []<typename x> {
+                return type_list<x, x>{};
+              }) == type_list<>{});
+static_assert(transform(type_list<int, char>{}, []<typename x> {
+                return type_list<x, x>{};
+              }) == type_list<int, int, char, char>{});
+static_assert(transform(tags, []<typename x> { return type_list<x>{}; }) ==
+              tags);
+
+// Flatten nested 'type_list' instances.
+//
+static_assert(flatten(type_list<>{}) == type_list<>{});
+static_assert(flatten(type_list<int, char>{}) == type_list<int, char>{});
+static_assert(flatten(type_list<float, type_list<>, int>{}) ==
+              type_list<float, int>{});
+static_assert(flatten(type_list<type_list<int, type_list<char>>,
+                                type_list<type_list<>, float>>{}) ==
+              type_list<int, char, float>{});
+
+// Call a function for a type given by a runtime index.
+//
+constexpr auto type_size = []<typename x> { return sizeof(x); };
+static_assert(visit(type_list<char>{}, 0, type_size) == 1);
+static_assert(visit(type_list<char, short, double>{}, 0, type_size) == 1);
+static_assert(visit(type_list<char, short, double>{}, 1, type_size) == 2);
+static_assert(visit(type_list<char, short, double>{}, 2, type_size) == 8);
+static_assert(visit(tags, 1234, []<typename x> {
+                return equal<x, tag<1234>>;
+              }));
+
+// Call a function for a combination of types given by runtime indices.
+//
+constexpr auto pair_size = []<typename x, typename y> {
+  return 10 * sizeof(x) + sizeof(y);
+};
+static_assert(visit(type_list<type_list<char, short, double>,
+                              type_list<int, char>>{},
+                    {0, 0}, pair_size) == 14);
+static_assert(visit(type_list<type_list<char, short, double>,
+                              type_list<int, char>>{},
+                    {1, 1}, pair_size) == 21);
+static_assert(visit(type_list<type_list<char, short, double>,
+                              type_list<int, char>>{},
+                    {2, 0}, pair_size) == 84);
+static_assert(visit(type_list<type_list<char>, type_list<short>>{}, {0, 0},
+                    pair_size) == 12);
+static_assert(visit(type_list<type_list<short, int, char>>{},
+                    std::array<size_t, 1>{2}, type_size) == 1);
@@ -0,0 +1,207 @@
+// This benchmark measures the compilation of the 'type_list' operations.
+// For every operation and list size, the translation unit 'type_list.cpp'
+// is compiled by a separate compiler process.
+// Its wall time, peak memory, and exit status are recorded.
+// For Clang, the number of template instantiations is extracted
+// from the output of '-ftime-trace'.
+// All results are printed to the standard output in CSV format
+// such that different versions of the library can be compared.
+//
+// Usage:
+//
+//   benchmarks [--compiler <path>] [--std <standard>] [--include <dir>]
+//              [--source <file>] [--timeout <seconds>] [--memory <MiB>]
+//              [--sizes <n>,...] [<operation>...]
+//
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <vector>
+//
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <unistd.h>
+//
+#include <lyra/xstd/utility.hpp>
+
+using namespace std;
+using namespace lyra::xstd;
+
+// The default paths are provided by the buildfile.
+//
+#ifndef LYRA_XSTD_BENCHMARK_CXX
+#define LYRA_XSTD_BENCHMARK_CXX "c++"
+#endif
+#ifndef LYRA_XSTD_BENCHMARK_INCLUDE
+#define LYRA_XSTD_BENCHMARK_INCLUDE "."
+#endif
+#ifndef LYRA_XSTD_BENCHMARK_SOURCE
+#define LYRA_XSTD_BENCHMARK_SOURCE "type_list.cpp"
+#endif
+
+namespace {
+
+struct options {
+  string compiler = LYRA_XSTD_BENCHMARK_CXX;
+  string standard = "c++2b";
+  string include = LYRA_XSTD_BENCHMARK_INCLUDE;
+  string source = LYRA_XSTD_BENCHMARK_SOURCE;
+  rlim_t timeout = 600;
+  rlim_t memory = RLIM_INFINITY;
+  vector<size_t> sizes{10, 100, 1'000, 10'000};
+  vector<string> operations{"element", "pop_back",  "reverse", "insert",
+                            "remove",  "trim_back", "range",   "swap",
+                            "merge",   "sort",      "transform"};
+};
+
+struct measurement {
+  int status;
+  float64 seconds;
+  long peak_memory;  // in KiB
+  long instantiations;
+};
+
+auto parse(int argc, char** argv) -> options {
+  options result{};
+  vector<string> operations{};
+  for (int i = 1; i < argc; ++i) {
+    const string arg = argv[i];
+    const auto value = [&] {
+      if (++i == argc)
+        throw invalid_argument("Missing value for option '" + arg + "'.");
+      return string{argv[i]};
+    };
+    if (arg == "--compiler")
+      result.compiler = value();
+    else if (arg == "--std")
+      result.standard = value();
+    else if (arg == "--include")
+      result.include = value();
+    else if (arg == "--source")
+      result.source = value();
+    else if (arg == "--timeout")
+      result.timeout = stoul(value());
+    else if (arg == "--memory")
+      result.memory = stoul(value()) << 20;
+    else if (arg == "--sizes") {
+      result.sizes.clear();
+      stringstream input{value()};
+      for (string size; getline(input, size, ',');)
+        result.sizes.push_back(stoul(size));
+    } else if (arg.starts_with("--"))
+      throw invalid_argument("Unknown option '" + arg + "'.");
+    else
+      operations.push_back(arg);
+  }
+  if (!empty(operations)) result.operations = operations;
+  return result;
+}
+
+bool is_clang(const string& compiler) {
+  return filesystem::path(compiler).filename().string().find("clang") !=
+         string::npos;
+}
+
+// Clang writes every instantiation as a separate event into its trace.
+//
+long count_instantiations(const filesystem::path& trace) {
+  ifstream file{trace};
+  if (!file) return -1;
+  const string content{istreambuf_iterator<char>{file}, {}};
+  long result = 0;
+  for (auto pattern : {"\"name\":\"InstantiateFunction\"",
+                       "\"name\":\"InstantiateClass\""}) {
+    for (auto pos = content.find(pattern); pos != string::npos;
+         pos = content.find(pattern, pos + 1))
+      ++result;
+  }
+  return result;
+}
+
+auto measure(const options& opts,
+             const string& operation,
+             size_t size,
+             const filesystem::path& directory) -> measurement {
+  const auto object = directory / "benchmark.o";
+  const auto trace = directory / "benchmark.json";
+  filesystem::remove(trace);
+
+  vector<string> args{opts.compiler,
+                      "-std=" + opts.standard,
+                      "-I" + opts.include,
+                      "-DLYRA_XSTD_BENCHMARK_OPERATION=" + operation,
+                      "-DLYRA_XSTD_BENCHMARK_SIZE=" + to_string(size),
+                      "-c",
+                      opts.source,
+                      "-o",
+                      object.string()};
+  const auto clang = is_clang(opts.compiler);
+  if (clang) {
+    args.push_back("-ftime-trace=" + trace.string());
+    args.push_back("-ftime-trace-granularity=0");
+  }
+  vector<char*> argv{};
+  for (auto& arg : args) argv.push_back(data(arg));
+  argv.push_back(nullptr);
+
+  const auto start = chrono::steady_clock::now();
+  const auto pid = fork();
+  if (pid < 0) throw runtime_error("Failed to fork the compiler process.");
+  if (pid == 0) {
+    const rlimit limit{opts.timeout, opts.timeout};
+    setrlimit(RLIMIT_CPU, &limit);
+    const rlimit memory{opts.memory, opts.memory};
+    setrlimit(RLIMIT_AS, &memory);
+    const auto null = open("/dev/null", O_WRONLY);
+    dup2(null, STDOUT_FILENO);
+    dup2(null, STDERR_FILENO);
+    execvp(argv[0], data(argv));
+    _exit(127);
+  }
+  int status;
+  rusage usage;
+  wait4(pid, &status, 0, &usage);
+  const auto end = chrono::steady_clock::now();
+
+  return {
+      .status = WIFEXITED(status) ? WEXITSTATUS(status)
+                                  : 128 + WTERMSIG(status),
+      .seconds = chrono::duration<float64>(end - start).count(),
+      // On Linux, 'ru_maxrss' is given in KiB.
+      .peak_memory = usage.ru_maxrss,
+      .instantiations = clang ? count_instantiations(trace) : -1,
+  };
+}
+
+}  // namespace
+
+int main(int argc, char** argv) try {
+  const auto opts = parse(argc, argv);
+
+  const auto directory =
+      filesystem::temp_directory_path() /
+      ("lyra-xstd-benchmarks-" + to_string(getpid()));
+  filesystem::create_directories(directory);
+
+  cout << "compiler,operation,size,status,seconds,peak_memory_kib,"
+          "instantiations\n";
+  for (const auto& operation : opts.operations) {
+    for (auto size : opts.sizes) {
+      const auto [status, seconds, peak_memory, instantiations] =
+          measure(opts, operation, size, directory);
+      cout << opts.compiler << ',' << operation << ',' << size << ','
+           << status << ',' << seconds << ',' << peak_memory << ','
+           << instantiations << endl;
+    }
+  }
+
+  filesystem::remove_all(directory);
+} catch (exception& e) {
+  cerr << e.what() << endl;
+  return 1;
+}
@@ -0,0 +1,135 @@
+#include <utility>
+//
+#include <lyra/xstd/type_list.hpp>
+
+// This translation unit is not part of the benchmark executable.
+// Instead, the benchmark driver compiles it once for every
+// combination of operation and list size while measuring the compiler.
+// Both parameters are given by the following macros.
+//
+#ifndef LYRA_XSTD_BENCHMARK_OPERATION
+#error "LYRA_XSTD_BENCHMARK_OPERATION has to be defined."
+#endif
+#ifndef LYRA_XSTD_BENCHMARK_SIZE
+#error "LYRA_XSTD_BENCHMARK_SIZE has to be defined."
+#endif
+
+using namespace lyra::xstd;
+
+constexpr size_t n = LYRA_XSTD_BENCHMARK_SIZE;
+
+// Every generated type gets its own identity by its index.
+// Its size is given separately to be able to feed
+// sorted and unsorted sequences to the ordering operations.
+//
+template <size_t index, size_t bytes = index + 1>
+struct tag {
+  char data[bytes];
+};
+
+// Generate the input lists without relying on any 'type_list' operation.
+// Otherwise, the generation itself would distort the measurements.
+//
+template <size_t... indices>
+consteval auto make_list(std::index_sequence<indices...>) {
+  return type_list<tag<indices>...>{};
+}
+//
+template <size_t... indices>
+consteval auto make_shuffled_list(std::index_sequence<indices...>) {
+  // 7919 is prime and therefore coprime to all benchmarked sizes.
+  // The sizes of the types build a permutation of [1, n].
+  return type_list<tag<indices, (indices * 7919) % n + 1>...>{};
+}
+//
+template <size_t offset, size_t... indices>
+consteval auto make_strided_list(std::index_sequence<indices...>) {
+  return type_list<tag<2 * indices + offset>...>{};
+}
+
+constexpr auto list = make_list(std::make_index_sequence<n>{});
+
+// All function objects are defined at namespace scope.
+// Lambdas defined inside the benchmark function templates would carry
+// the whole input list in their mangled names and
+// the measurement would be dominated by the code generation for them.
+//
+constexpr auto less = []<typename x, typename y> {
+  return sizeof(x) <= sizeof(y);
+};
+//
+constexpr auto odd = []<typename x> { return sizeof(x) % 2 != 0; };
+//
+constexpr auto duplicate_odd = []<typename x> {
+  if constexpr (odd.operator()<x>())
+    return type_list<x, x>{};
+  else
+    return type_list<>{};
+};
+
+// For every benchmarked operation, there is a respective function template.
+// Only the selected one will be instantiated.
+// The namespace must not be associated with the generated types.
+// Otherwise, argument-dependent lookup inside the library
+// would consider these functions as well.
+//
+namespace benchmark {
+
+consteval auto element(auto list) {
+  return type_list<decltype(lyra::xstd::element<n - 1>(list))>{};
+}
+//
+consteval auto pop_back(auto list) {
+  return lyra::xstd::pop_back(list);
+}
+//
+consteval auto reverse(auto list) {
+  return lyra::xstd::reverse(list);
+}
+//
+consteval auto insert(auto list) {
+  return lyra::xstd::insert<n - 1, void>(list);
+}
+//
+consteval auto remove(auto list) {
+  return lyra::xstd::remove(list, odd);
+}
+//
+consteval auto trim_back(auto list) {
+  return lyra::xstd::trim_back<n / 2>(list);
+}
+//
+consteval auto range(auto list) {
+  return lyra::xstd::range<n / 4, n - n / 4>(list);
+}
+//
+consteval auto swap(auto list) {
+  return lyra::xstd::swap<0, n - 1>(list);
+}
+//
+// The inputs for 'merge' and 'sort' have to depend on the parameter.
+// Otherwise, they would be evaluated even if not selected.
+//
+consteval auto merge(auto list) {
+  constexpr auto m = size(decltype(list){});
+  return lyra::xstd::merge(
+      make_strided_list<0>(std::make_index_sequence<m / 2>{}),
+      make_strided_list<1>(std::make_index_sequence<m - m / 2>{}), less);
+}
+//
+consteval auto sort(auto list) {
+  constexpr auto m = size(decltype(list){});
+  return lyra::xstd::sort(make_shuffled_list(std::make_index_sequence<m>{}),
+                          less);
+}
+//
+consteval auto transform(auto list) {
+  return lyra::xstd::transform(list, duplicate_odd);
+}
+
+}  // namespace benchmark
+
+// The result is forced to be evaluated at compile time.
+//
+constexpr auto result = benchmark::LYRA_XSTD_BENCHMARK_OPERATION(list);
+static_assert(instance::type_list<std::decay_t<decltype(result)>>);
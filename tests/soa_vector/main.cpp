@@ -0,0 +1,94 @@
+#include <cassert>
+#include <string>
+//
+#include <lyra/xstd/soa_vector.hpp>
+
+using lyra::xstd::soa_vector;
+using lyra::xstd::type_list;
+
+using records = soa_vector<type_list<float, int, std::string>>;
+
+static bool aligned(const void* ptr) {
+  return reinterpret_cast<std::uintptr_t>(ptr) % records::alignment == 0;
+}
+
+int main() {
+  // An empty container does not allocate.
+  //
+  {
+    records x{};
+    assert(x.empty());
+    assert(x.size() == 0);
+    assert(x.capacity() == 0);
+    assert(x.column<0>().empty());
+  }
+
+  // Appending elements fills all columns.
+  // The columns keep their alignment over reallocations.
+  //
+  {
+    records x{};
+    for (int i = 0; i < 100; ++i)
+      x.push_back(0.5f * i, i, std::to_string(i));
+    assert(x.size() == 100);
+    assert(x.capacity() >= 100);
+    assert(aligned(x.data<0>()));
+    assert(aligned(x.data<1>()));
+    assert(aligned(x.data<2>()));
+
+    const auto floats = x.column<float>();
+    const auto ints = x.column<1>();
+    const auto strings = x.column<std::string>();
+    for (int i = 0; i < 100; ++i) {
+      assert(floats[i] == 0.5f * i);
+      assert(ints[i] == i);
+      assert(strings[i] == std::to_string(i));
+    }
+
+    // Row proxies reference the fields of a single element.
+    //
+    x[42].get<1>() = -1;
+    assert(ints[42] == -1);
+    assert(x[42].value() == std::tuple(21.0f, -1, std::string{"42"}));
+
+    x.pop_back();
+    assert(x.size() == 99);
+  }
+
+  // Resizing value-initializes new elements and keeps old ones.
+  //
+  {
+    records x{3};
+    assert(x.size() == 3);
+    assert(x.column<1>()[2] == 0);
+    assert(x.column<2>()[2].empty());
+    x.column<2>()[0] = "first";
+    x.resize(1000);
+    assert(x.size() == 1000);
+    assert(x.column<2>()[0] == "first");
+    assert(x.column<0>()[999] == 0.0f);
+    x.resize(1);
+    assert(x.size() == 1);
+    assert(x.column<2>()[0] == "first");
+    x.clear();
+    assert(x.empty());
+  }
+
+  // Copies are deep and moves transfer the allocation.
+  //
+  {
+    records x{};
+    x.push_back(1.0f, 2, "three");
+    records y{x};
+    y.column<1>()[0] = 5;
+    assert(x.column<1>()[0] == 2);
+    assert(y.column<2>()[0] == "three");
+
+    const auto ptr = y.data<0>();
+    records z{std::move(y)};
+    assert(z.data<0>() == ptr);
+    assert(y.empty());
+    x = z;
+    assert(x.column<1>()[0] == 5);
+  }
+}
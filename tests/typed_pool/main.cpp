@@ -0,0 +1,126 @@
+#include <array>
+#include <cassert>
+#include <string>
+//
+#include <lyra/xstd/typed_pool.hpp>
+
+using lyra::xstd::type_list;
+using lyra::xstd::typed_pool;
+
+struct particle {
+  float x, y, z;
+};
+
+struct alignas(32) block {
+  char data[32];
+};
+
+using types = type_list<int, float, particle, std::string, block>;
+using pools = typed_pool<types>;
+using merged_pools = typed_pool<types, true>;
+
+// Without merging, every type has its own pool.
+//
+static_assert(pools::pool_count == 5);
+static_assert(pools::pool_index<int> == 0);
+static_assert(pools::pool_index<float> == 1);
+static_assert(pools::pool_index<block> == 4);
+
+// With merging, 'int' and 'float' share the same size class.
+//
+static_assert(merged_pools::pool_count == 4);
+static_assert(merged_pools::pool_index<int> == 0);
+static_assert(merged_pools::pool_index<float> == 0);
+static_assert(merged_pools::pool_index<particle> == 1);
+static_assert(merged_pools::pool_index<block> == 3);
+
+static bool aligned(const void* ptr, size_t alignment) {
+  return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+int main() {
+  // Single objects are created and destroyed in their own pool.
+  //
+  {
+    pools p{};
+    const auto s = p.create<std::string>("pooled");
+    const auto b = p.create<block>();
+    const auto x = p.create<particle>(1.0f, 2.0f, 3.0f);
+    assert(*s == "pooled");
+    assert(aligned(b, alignof(block)));
+    assert(x->z == 3.0f);
+
+    const auto stats = p.statistics<std::string>();
+    assert(stats.slot_size == sizeof(std::string));
+    assert(stats.slabs == 1);
+    assert(stats.used == 1);
+    assert(stats.allocations == 1);
+    assert(p.statistics<int>().capacity == 0);
+
+    p.destroy(s);
+    p.destroy(b);
+    p.destroy(x);
+    assert(p.statistics<std::string>().used == 0);
+    assert(p.statistics<std::string>().deallocations == 1);
+
+    // Freed slots are reused first.
+    //
+    const auto t = p.allocate<std::string>();
+    assert(static_cast<void*>(t) == static_cast<void*>(s));
+    p.deallocate(t);
+  }
+
+  // Types of the same size class share their slots.
+  //
+  {
+    merged_pools p{};
+    const auto i = p.create<int>(1);
+    p.destroy(i);
+    const auto f = p.create<float>(2.0f);
+    assert(static_cast<void*>(f) == static_cast<void*>(i));
+    assert(p.statistics<int>().allocations == 2);
+    p.destroy(f);
+  }
+
+  // Bulk allocations grow the pool at most once.
+  //
+  {
+    pools p{};
+    std::array<particle*, 10000> ptrs{};
+    p.allocate<particle>(ptrs);
+    auto stats = p.statistics<particle>();
+    assert(stats.slabs == 1);
+    assert(stats.capacity >= ptrs.size());
+    assert(stats.used == ptrs.size());
+    for (size_t i = 0; i < ptrs.size(); ++i) {
+      assert(aligned(ptrs[i], alignof(particle)));
+      ptrs[i]->x = float(i);
+    }
+    for (size_t i = 0; i < ptrs.size(); ++i) assert(ptrs[i]->x == float(i));
+
+    p.deallocate<particle>(ptrs);
+    stats = p.statistics<particle>();
+    assert(stats.used == 0);
+    assert(stats.deallocations == ptrs.size());
+
+    // Reserving does not allocate if enough slots are free.
+    //
+    p.reserve<particle>(ptrs.size());
+    assert(p.statistics<particle>().slabs == 1);
+  }
+
+  // Single allocations grow the pool geometrically.
+  //
+  {
+    pools p{};
+    std::array<int*, 5000> ptrs{};
+    for (auto& ptr : ptrs) ptr = p.create<int>(7);
+    const auto stats = p.statistics<int>();
+    assert(stats.used == ptrs.size());
+    assert(stats.slabs < 8);
+    for (auto ptr : ptrs) {
+      assert(*ptr == 7);
+      p.destroy(ptr);
+    }
+  }
+}
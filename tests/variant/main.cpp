@@ -0,0 +1,140 @@
+#include <cassert>
+#include <string>
+//
+#include <lyra/xstd/variant.hpp>
+
+using lyra::xstd::type_list;
+using lyra::xstd::variant;
+using lyra::xstd::meta::equal;
+
+template <size_t index>
+struct tag {};
+
+template <size_t... indices>
+consteval auto make_tags(std::index_sequence<indices...>) {
+  return type_list<tag<indices>...>{};
+}
+
+// The discriminator is the smallest unsigned integer type
+// that is able to store all alternative indices.
+//
+using small = variant<decltype(make_tags(std::make_index_sequence<256>{}))>;
+using large = variant<decltype(make_tags(std::make_index_sequence<257>{}))>;
+static_assert(equal<small::index_type, lyra::xstd::uint8>);
+static_assert(equal<large::index_type, lyra::xstd::uint16>);
+static_assert(sizeof(small) == 2);
+static_assert(sizeof(large) == 4);
+
+// The storage is given by the largest size and alignment.
+//
+using message = variant<type_list<char, int32_t, double>>;
+static_assert(sizeof(message) == 16);
+static_assert(alignof(message) == alignof(double));
+static_assert(sizeof(variant<type_list<uint32_t, std::array<char, 5>>>) == 8);
+
+// Trivial alternatives lead to a trivially copyable variant.
+//
+static_assert(std::is_trivially_copyable_v<message>);
+static_assert(!std::is_trivially_copyable_v<variant<type_list<std::string>>>);
+
+int main() {
+  // The first alternative is value-initialized by default.
+  //
+  {
+    message x{};
+    assert(x.index() == 0);
+    assert(x.holds<char>());
+    assert(x.get<0>() == '\0');
+  }
+
+  // Alternatives are selected by their exact type or index.
+  //
+  {
+    message x{2.5};
+    assert(x.index() == 2);
+    assert(x.get<double>() == 2.5);
+    message y{std::in_place_index<1>, 7};
+    assert(y.holds<1>());
+    assert(y.get<int32_t>() == 7);
+    y = x;
+    assert(y.get<2>() == 2.5);
+  }
+
+  // Visitation calls the function object with the stored value.
+  //
+  {
+    message x{'a'};
+    const auto name = [](auto value) -> std::string {
+      if constexpr (equal<decltype(value), char>)
+        return "char";
+      else if constexpr (equal<decltype(value), int32_t>)
+        return "int";
+      else
+        return "double";
+    };
+    assert(x.visit(name) == "char");
+    x.emplace<int32_t>(3);
+    assert(x.visit(name) == "int");
+    x.emplace<2>(1.0);
+    assert(x.visit(name) == "double");
+    x.visit([](auto& value) { value *= 2; });
+    assert(x.get<double>() == 2.0);
+  }
+
+  // Single alternatives are visited without any dispatch.
+  //
+  {
+    variant<type_list<int>> x{5};
+    assert(x.visit([](int value) { return value + 1; }) == 6);
+  }
+
+  // Non-trivial alternatives are copied, moved, and destroyed.
+  //
+  {
+    using names = variant<type_list<int, std::string>>;
+    names x{std::string(100, 'x')};
+    names y{x};
+    assert(y.get<std::string>() == x.get<std::string>());
+    names z{std::move(y)};
+    assert(z.get<1>().size() == 100);
+    z = names{3};
+    assert(z.get<int>() == 3);
+    z = x;
+    assert(z.get<std::string>() == std::string(100, 'x'));
+    z.emplace<std::string>("short");
+    assert(std::move(z).get<std::string>() == "short");
+  }
+
+  // Equal types are distinguished by their index.
+  //
+  {
+    variant<type_list<int, int>> x{std::in_place_index<1>, 4};
+    assert(x.index() == 1);
+    assert(x.get<1>() == 4);
+    x.emplace<0>(2);
+    assert(x.visit([](int value) { return value; }) == 2);
+  }
+
+  // A throwing construction keeps the previous value.
+  //
+  {
+    struct throwing {
+      throwing(int) { throw 0; }
+      throwing(throwing&&) noexcept = default;
+    };
+    variant<type_list<std::string, throwing>> x{std::string{"keep"}};
+    try {
+      x.emplace<throwing>(1);
+    } catch (int) {
+    }
+    assert(x.get<std::string>() == "keep");
+  }
+
+  // Large lists use the same single jump table.
+  //
+  {
+    large x{tag<256>{}};
+    assert(x.index() == 256);
+    assert(x.visit([]<size_t i>(tag<i>) { return i; }) == 256);
+  }
+}